@@ -0,0 +1,102 @@
+#include "Benchmark.hpp"
+
+#include <Arcane/System/PoolAllocator.hpp>
+#include <atomic>
+#include <vector>
+
+// Allocations per run, split across the threads. Each thread keeps
+// AllocatorLiveBlocks blocks alive and replaces a random one each step.
+static constexpr uint64_t AllocatorOps = 1 << 22;
+static constexpr uint32_t AllocatorLiveBlocks = 512;
+
+struct PoolHeap {
+	static inline void *Allocate(size_t size) { return PoolAllocate(size); }
+	static inline void Free(void *ptr, size_t size) { PoolFree(ptr, size); }
+};
+
+struct MallocHeap {
+	static inline void *Allocate(size_t size) { return std::malloc(size); }
+	static inline void Free(void *ptr, size_t) { std::free(ptr); }
+};
+
+struct LiveBlock {
+	uint64_t *Pointer;
+	size_t Size;
+};
+
+struct AllocatorRun {
+	uint64_t OpsPerThread;
+	std::atomic<uint32_t> Corrupted;
+};
+
+// Every block starts with a tag naming its owner and slot, so two live
+// blocks that overlap are caught when the first one is freed.
+template<typename _Heap>
+static void ChurnThread(uint32_t threadIndex, void *data) {
+	AllocatorRun &run = *(AllocatorRun*)data;
+	std::vector<LiveBlock> blocks(AllocatorLiveBlocks);
+
+	uint32_t random = 0x9E3779B9u * (threadIndex + 1);
+	auto next = [&random]() {
+		random ^= random << 13;
+		random ^= random >> 17;
+		random ^= random << 5;
+		return random;
+	};
+
+	auto allocate = [&](uint32_t slot) {
+		const size_t size = 8 + next() % (AR_POOL_MAX_SIZE - 8 + 1);
+		blocks[slot].Pointer = (uint64_t*)_Heap::Allocate(size);
+		blocks[slot].Size = size;
+		*blocks[slot].Pointer = ((uint64_t)threadIndex << 32) | slot;
+	};
+
+	uint32_t corrupted = 0;
+	auto release = [&](uint32_t slot) {
+		corrupted += *blocks[slot].Pointer != (((uint64_t)threadIndex << 32) | slot);
+		_Heap::Free(blocks[slot].Pointer, blocks[slot].Size);
+	};
+
+	for (uint32_t slot = 0; slot < AllocatorLiveBlocks; slot++) {
+		allocate(slot);
+	}
+
+	for (uint64_t i = 0; i < run.OpsPerThread; i++) {
+		const uint32_t slot = next() % AllocatorLiveBlocks;
+		release(slot);
+		allocate(slot);
+	}
+
+	for (uint32_t slot = 0; slot < AllocatorLiveBlocks; slot++) {
+		release(slot);
+	}
+
+	run.Corrupted.fetch_add(corrupted, std::memory_order_relaxed);
+}
+
+// Returns nanoseconds per free/allocate pair, measured over all threads.
+template<typename _Heap>
+static double RunChurn(uint32_t threads) {
+	AllocatorRun run;
+	run.OpsPerThread = AllocatorOps / threads;
+	run.Corrupted.store(0);
+
+	const uint64_t micros = RunOnThreads(threads, ChurnThread<_Heap>, &run);
+
+	Check(run.Corrupted.load() == 0, "Allocator handed out overlapping blocks");
+	return GetNanosPerOp(run.OpsPerThread * threads, micros);
+}
+
+void RunAllocatorBenchmarks() {
+	std::printf("Random churn of 8-%u byte blocks, ns per free/allocate\n", AR_POOL_MAX_SIZE);
+	std::printf("%8s %12s %12s\n", "threads", "pool", "malloc");
+	for (uint32_t threads : BenchmarkThreadCounts) {
+		std::printf("%8u %12.2f %12.2f\n", threads,
+			RunChurn<PoolHeap>(threads),
+			RunChurn<MallocHeap>(threads)
+		);
+	}
+
+	const PoolStats stats = GetPoolStats();
+	std::printf("Pool reserved %llu KB in %llu slabs\n", (unsigned long long)(stats.ReservedSize / 1024), (unsigned long long)stats.SlabCount);
+}
\ No newline at end of file
@@ -0,0 +1,57 @@
+#include "Benchmark.hpp"
+
+#include <atomic>
+#include <vector>
+
+struct BenchmarkThread {
+	BenchmarkThreadFunc *Func;
+	void *Data;
+	uint32_t Index;
+	std::atomic<bool> *Go;
+	std::atomic<uint32_t> *Ready;
+};
+
+static int32_t BenchmarkThreadMain(void *data) {
+	BenchmarkThread *thread = (BenchmarkThread*)data;
+	thread->Ready->fetch_add(1, std::memory_order_release);
+	while (!thread->Go->load(std::memory_order_acquire)) AR_CPU_PAUSE();
+
+	thread->Func(thread->Index, thread->Data);
+	return 0;
+}
+
+uint64_t RunOnThreads(uint32_t threadCount, BenchmarkThreadFunc *func, void *data) {
+	std::atomic<bool> go(false);
+	std::atomic<uint32_t> ready(0);
+
+	std::vector<BenchmarkThread> info(threadCount);
+	std::vector<Thread> threads(threadCount);
+	for (uint32_t i = 0; i < threadCount; i++) {
+		info[i] = { func, data, i, &go, &ready };
+		threads[i] = Thread::Create(BenchmarkThreadMain, &info[i]);
+		threads[i].Start();
+	}
+
+	// Thread creation is kept out of the measurement.
+	while (ready.load(std::memory_order_acquire) < threadCount) Thread::Switch();
+
+	const uint64_t start = GetCurrentTimeMicros();
+	go.store(true, std::memory_order_release);
+	for (const Thread &thread : threads) {
+		Thread::Await(thread);
+	}
+
+	return GetCurrentTimeMicros() - start;
+}
+
+static uint32_t sFailures = 0;
+
+void Check(bool condition, const char *message) {
+	if (condition) return;
+	std::printf("  FAILED: %s\n", message);
+	sFailures++;
+}
+
+uint32_t GetFailureCount() {
+	return sFailures;
+}
\ No newline at end of file
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <Arcane/Core.hpp>
+#include <Arcane/System/Thread.hpp>
+#include <Arcane/System/Time.hpp>
+
+#ifdef _MSC_VER
+#	include <intrin.h>
+#endif
+
+using namespace Arcane;
+
+// Numbers are only meaningful in the Release configuration; Debug builds
+// track every allocation and enable Tracy.
+
+typedef void BenchmarkThreadFunc(uint32_t threadIndex, void *data);
+
+// Starts threadCount threads, releases them together and returns the
+// microseconds until the last one has returned.
+uint64_t RunOnThreads(uint32_t threadCount, BenchmarkThreadFunc *func, void *data);
+
+// Records a failure when a result is wrong or out of its documented
+// bounds. main() returns non-zero if any check failed.
+void Check(bool condition, const char *message);
+uint32_t GetFailureCount();
+
+inline double GetMillionOpsPerSecond(uint64_t ops, uint64_t micros) {
+	return micros ? (double)ops / (double)micros : 0.0;
+}
+
+inline double GetNanosPerOp(uint64_t ops, uint64_t micros) {
+	return ops ? (double)micros * 1000.0 / (double)ops : 0.0;
+}
+
+// Keeps the compiler from dropping a computation whose result is unused.
+template<typename _Type>
+inline void KeepResult(const _Type &value) {
+#ifdef _MSC_VER
+	static volatile char sink;
+	sink = *(const volatile char*)&value;
+	_ReadWriteBarrier();
+#else
+	asm volatile("" : : "g"(&value) : "memory");
+#endif
+}
+
+// Thread counts used by the contention benchmarks.
+constexpr uint32_t BenchmarkThreadCounts[] = { 1, 2, 4, 8, 16 };
+
+void RunQueueBenchmarks();
+void RunMutexBenchmarks();
+void RunAllocatorBenchmarks();
+void RunContainerBenchmarks();
+void RunMatrixBenchmarks();
+void RunFastMathBenchmarks();
+void RunImageBenchmarks();
\ No newline at end of file
@@ -0,0 +1,169 @@
+#include "Benchmark.hpp"
+
+#include <Arcane/Data/SmallVector.hpp>
+#include <Arcane/Data/HashMap.hpp>
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+// Every measurement covers roughly this many operations.
+static constexpr uint64_t ContainerOps = 1 << 22;
+
+template<typename _Vector>
+static inline void PushBack(_Vector &vector, uint32_t value) {
+	if constexpr (requires { vector.push_back(value); }) vector.push_back(value);
+	else vector.Push(value);
+}
+
+// Builds, reads and destroys a vector of `count` elements, the way
+// per-draw and per-layout lists are used. Returns ns per vector.
+template<typename _Vector>
+static double RunVector(uint32_t count, uint64_t &checksum) {
+	const uint64_t repeats = ContainerOps / count;
+	const uint64_t start = GetCurrentTimeMicros();
+
+	uint64_t sum = 0;
+	for (uint64_t i = 0; i < repeats; i++) {
+		_Vector vector;
+		for (uint32_t j = 0; j < count; j++) PushBack(vector, (uint32_t)i + j);
+		for (uint32_t value : vector) sum += value;
+		KeepResult(vector);
+	}
+
+	const uint64_t micros = GetCurrentTimeMicros() - start;
+	checksum = sum;
+	return GetNanosPerOp(repeats, micros);
+}
+
+static void RunVectorBenchmarks() {
+	std::printf("Build, sum and destroy a vector, ns per vector\n");
+	std::printf("%8s %16s %16s %16s\n", "elements", "SmallVector<8>", "FixedVector<16>", "std::vector");
+	for (uint32_t count : { 2u, 4u, 8u, 16u }) {
+		uint64_t small, fixed, standard;
+		std::printf("%8u %16.2f %16.2f %16.2f\n", count,
+			RunVector<SmallVector<uint32_t, 8>>(count, small),
+			RunVector<FixedVector<uint32_t, 16>>(count, fixed),
+			RunVector<std::vector<uint32_t>>(count, standard)
+		);
+		Check(small == standard && fixed == standard, "Vectors disagree on their contents");
+	}
+}
+
+// Multiplying by an odd constant is a bijection, so keys made from even
+// and odd indices are all distinct and never collide with each other.
+static std::vector<uint32_t> MakeKeys(uint32_t count, uint32_t parity) {
+	std::vector<uint32_t> keys(count);
+	for (uint32_t i = 0; i < count; i++) {
+		keys[i] = (2 * i + parity) * 0x9E3779B1u;
+	}
+	return keys;
+}
+
+struct MapResult {
+	double InsertNanos;
+	double HitNanos;
+	double MissNanos;
+	double IterateNanos;
+	uint64_t Checksum;
+};
+
+template<typename _Map>
+static inline void InsertKey(_Map &map, uint32_t key, uint32_t value) {
+	if constexpr (requires { map.emplace(key, value); }) map.emplace(key, value);
+	else map.Insert(key, value);
+}
+
+template<typename _Map>
+static inline const uint32_t *FindKey(const _Map &map, uint32_t key) {
+	if constexpr (requires { map.find(key); }) {
+		const auto it = map.find(key);
+		return it == map.end() ? nullptr : &it->second;
+	} else {
+		return map.Find(key);
+	}
+}
+
+template<typename _Map>
+static inline uint64_t SumValues(const _Map &map) {
+	uint64_t sum = 0;
+	if constexpr (requires { map.begin()->second; }) {
+		for (const auto &pair : map) sum += pair.second;
+	} else if constexpr (requires { map.begin()->Value; }) {
+		for (const auto &entry : map) sum += entry.Value;
+	} else {
+		for (uint32_t value : map) sum += value;
+	}
+	return sum;
+}
+
+template<typename _Map>
+static MapResult RunMap(const std::vector<uint32_t> &keys, const std::vector<uint32_t> &missing) {
+	const uint32_t count = (uint32_t)keys.size();
+	const uint64_t repeats = std::max<uint64_t>(ContainerOps / count, 1);
+	const uint64_t insertRepeats = std::max<uint64_t>(repeats / 4, 1);
+	MapResult result{};
+
+	// Insertion includes growing the map from empty, as a freshly built
+	// lookup table would.
+	uint64_t start = GetCurrentTimeMicros();
+	for (uint64_t i = 0; i < insertRepeats; i++) {
+		_Map map;
+		for (uint32_t j = 0; j < count; j++) InsertKey(map, keys[j], j);
+		KeepResult(map);
+	}
+	result.InsertNanos = GetNanosPerOp(insertRepeats * count, GetCurrentTimeMicros() - start);
+
+	_Map map;
+	for (uint32_t j = 0; j < count; j++) InsertKey(map, keys[j], j);
+
+	uint64_t sum = 0;
+	start = GetCurrentTimeMicros();
+	for (uint64_t i = 0; i < repeats; i++) {
+		for (uint32_t key : keys) sum += *FindKey(map, key);
+	}
+	result.HitNanos = GetNanosPerOp(repeats * count, GetCurrentTimeMicros() - start);
+
+	uint64_t found = 0;
+	start = GetCurrentTimeMicros();
+	for (uint64_t i = 0; i < repeats; i++) {
+		for (uint32_t key : missing) found += FindKey(map, key) != nullptr;
+	}
+	result.MissNanos = GetNanosPerOp(repeats * count, GetCurrentTimeMicros() - start);
+
+	start = GetCurrentTimeMicros();
+	for (uint64_t i = 0; i < repeats; i++) {
+		sum += SumValues(map);
+	}
+	result.IterateNanos = GetNanosPerOp(repeats * count, GetCurrentTimeMicros() - start);
+
+	result.Checksum = sum + found;
+	return result;
+}
+
+static void RunMapBenchmarks() {
+	std::printf("\nuint32_t -> uint32_t maps, ns per element\n");
+	std::printf("%8s %-20s %10s %10s %10s %10s\n", "elements", "", "insert", "hit", "miss", "iterate");
+	for (uint32_t count : { 16u, 256u, 4096u, 65536u }) {
+		const std::vector<uint32_t> keys = MakeKeys(count, 0);
+		const std::vector<uint32_t> missing = MakeKeys(count, 1);
+
+		const MapResult results[] = {
+			RunMap<HashMap<uint32_t, uint32_t>>(keys, missing),
+			RunMap<DenseMap<uint32_t, uint32_t>>(keys, missing),
+			RunMap<std::unordered_map<uint32_t, uint32_t>>(keys, missing),
+		};
+		const char *names[] = { "HashMap", "DenseMap", "std::unordered_map" };
+
+		for (uint32_t i = 0; i < 3; i++) {
+			std::printf("%8u %-20s %10.2f %10.2f %10.2f %10.2f\n", count, names[i],
+				results[i].InsertNanos, results[i].HitNanos, results[i].MissNanos, results[i].IterateNanos
+			);
+		}
+		Check(results[0].Checksum == results[2].Checksum && results[1].Checksum == results[2].Checksum, "Maps disagree on their contents");
+	}
+}
+
+void RunContainerBenchmarks() {
+	RunVectorBenchmarks();
+	RunMapBenchmarks();
+}
\ No newline at end of file
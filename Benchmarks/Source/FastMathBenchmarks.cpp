@@ -0,0 +1,251 @@
+#include "Benchmark.hpp"
+
+#include <Arcane/Math/FastMath.hpp>
+#include <Arcane/System/CPU.hpp>
+#include <vector>
+
+static constexpr uint32_t AccuracySamples = 1 << 20;
+static constexpr uint32_t ThroughputSamples = 4096;
+static constexpr uint32_t ThroughputRepeats = 2048;
+
+// Each operation describes its input range, its reference and the maximum
+// error FastMath.hpp documents for it, and forwards to the scalar, SSE and
+// AVX2 overloads. The AVX2 one must carry the target attribute itself so
+// the intrinsics can be inlined into it.
+
+struct SinOp {
+	static constexpr const char *Name = "FastSin";
+	static constexpr bool Relative = false;
+	static constexpr float HighBound = 2.5e-7f;
+	static constexpr float LowBound = 2e-6f;
+
+	static float GetInput(uint32_t i, uint32_t count, float &) { return -100.0f * Pi + 200.0f * Pi * i / (count - 1); }
+	static double Reference(double a, double) { return std::sin(a); }
+	static float Libm(float a, float) { return std::sin(a); }
+
+	template<FastMathPrecision _P> static inline float Run(float a, float) { return FastSin<_P>(a); }
+#if AR_MATH_SIMD
+	template<FastMathPrecision _P> static inline __m128 Run(__m128 a, __m128) { return FastSin<_P>(a); }
+	template<FastMathPrecision _P> AR_TARGET_AVX2 static inline __m256 Run(__m256 a, __m256) { return FastSin<_P>(a); }
+#endif
+};
+
+struct CosOp {
+	static constexpr const char *Name = "FastCos";
+	static constexpr bool Relative = false;
+	static constexpr float HighBound = 3e-7f;
+	static constexpr float LowBound = 1e-5f;
+
+	static float GetInput(uint32_t i, uint32_t count, float &b) { return SinOp::GetInput(i, count, b); }
+	static double Reference(double a, double) { return std::cos(a); }
+	static float Libm(float a, float) { return std::cos(a); }
+
+	template<FastMathPrecision _P> static inline float Run(float a, float) { return FastCos<_P>(a); }
+#if AR_MATH_SIMD
+	template<FastMathPrecision _P> static inline __m128 Run(__m128 a, __m128) { return FastCos<_P>(a); }
+	template<FastMathPrecision _P> AR_TARGET_AVX2 static inline __m256 Run(__m256 a, __m256) { return FastCos<_P>(a); }
+#endif
+};
+
+struct RSqrtOp {
+	static constexpr const char *Name = "RSqrt";
+	static constexpr bool Relative = true;
+	static constexpr float HighBound = 3e-7f;
+	static constexpr float LowBound = AR_MATH_SIMD ? 3.5e-4f : 1.8e-3f;
+
+	static float GetInput(uint32_t i, uint32_t count, float &) { return (float)std::pow(10.0, -6.0 + 12.0 * i / (count - 1)); }
+	static double Reference(double a, double) { return 1.0 / std::sqrt(a); }
+	static float Libm(float a, float) { return 1.0f / std::sqrt(a); }
+
+	template<FastMathPrecision _P> static inline float Run(float a, float) { return RSqrt<_P>(a); }
+#if AR_MATH_SIMD
+	template<FastMathPrecision _P> static inline __m128 Run(__m128 a, __m128) { return RSqrt<_P>(a); }
+	template<FastMathPrecision _P> AR_TARGET_AVX2 static inline __m256 Run(__m256 a, __m256) { return RSqrt<_P>(a); }
+#endif
+};
+
+struct Atan2Op {
+	static constexpr const char *Name = "FastAtan2";
+	static constexpr bool Relative = false;
+	static constexpr float HighBound = 3e-7f;
+	static constexpr float LowBound = 2.1e-4f;
+
+	// Every direction around the circle, at radii from 1e-3 to 1e3.
+	static float GetInput(uint32_t i, uint32_t count, float &b) {
+		const double angle = 2.0 * Pi * i / count;
+		const double radius = std::pow(10.0, -3.0 + 6.0 * ((i * 7919u) % count) / count);
+		b = (float)(radius * std::cos(angle));
+		return (float)(radius * std::sin(angle));
+	}
+	static double Reference(double a, double b) { return std::atan2(a, b); }
+	static float Libm(float a, float b) { return std::atan2(a, b); }
+
+	template<FastMathPrecision _P> static inline float Run(float a, float b) { return FastAtan2<_P>(a, b); }
+#if AR_MATH_SIMD
+	template<FastMathPrecision _P> static inline __m128 Run(__m128 a, __m128 b) { return FastAtan2<_P>(a, b); }
+	template<FastMathPrecision _P> AR_TARGET_AVX2 static inline __m256 Run(__m256 a, __m256 b) { return FastAtan2<_P>(a, b); }
+#endif
+};
+
+struct ExpOp {
+	static constexpr const char *Name = "FastExp";
+	static constexpr bool Relative = true;
+	static constexpr float HighBound = 3e-7f;
+	static constexpr float LowBound = 6e-5f;
+
+	static float GetInput(uint32_t i, uint32_t count, float &) { return FastMathExpMin + (FastMathExpMax - FastMathExpMin) * i / (count - 1); }
+	static double Reference(double a, double) { return std::exp(a); }
+	static float Libm(float a, float) { return std::exp(a); }
+
+	template<FastMathPrecision _P> static inline float Run(float a, float) { return FastExp<_P>(a); }
+#if AR_MATH_SIMD
+	template<FastMathPrecision _P> static inline __m128 Run(__m128 a, __m128) { return FastExp<_P>(a); }
+	template<FastMathPrecision _P> AR_TARGET_AVX2 static inline __m256 Run(__m256 a, __m256) { return FastExp<_P>(a); }
+#endif
+};
+
+typedef void FastMathKernel(const float *a, const float *b, float *out, size_t count);
+
+template<typename _Op>
+static void RunLibm(const float *a, const float *b, float *out, size_t count) {
+	for (size_t i = 0; i < count; i++) out[i] = _Op::Libm(a[i], b[i]);
+}
+
+template<typename _Op, FastMathPrecision _P>
+static void RunScalar(const float *a, const float *b, float *out, size_t count) {
+	for (size_t i = 0; i < count; i++) out[i] = _Op::template Run<_P>(a[i], b[i]);
+}
+
+#if AR_MATH_SIMD
+template<typename _Op, FastMathPrecision _P>
+static void RunSSE(const float *a, const float *b, float *out, size_t count) {
+	for (size_t i = 0; i < count; i += 4) {
+		_mm_storeu_ps(out + i, _Op::template Run<_P>(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+	}
+}
+
+template<typename _Op, FastMathPrecision _P>
+AR_TARGET_AVX2 static void RunAVX2(const float *a, const float *b, float *out, size_t count) {
+	for (size_t i = 0; i < count; i += 8) {
+		_mm256_storeu_ps(out + i, _Op::template Run<_P>(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+	}
+}
+#endif
+
+struct FastMathKernels {
+	FastMathKernel *Scalar;
+	FastMathKernel *SSE;
+	FastMathKernel *AVX2;
+};
+
+template<typename _Op, FastMathPrecision _P>
+static FastMathKernels GetKernels() {
+#if AR_MATH_SIMD
+	return { RunScalar<_Op, _P>, RunSSE<_Op, _P>, HasAVX2() ? RunAVX2<_Op, _P> : nullptr };
+#else
+	return { RunScalar<_Op, _P>, nullptr, nullptr };
+#endif
+}
+
+// Largest error of the kernel's results against the double precision
+// reference, or -1 when the kernel is not available on this build or CPU.
+template<typename _Op>
+static double MeasureError(FastMathKernel *kernel, const std::vector<float> &a, const std::vector<float> &b) {
+	if (!kernel) return -1.0;
+
+	std::vector<float> out(a.size());
+	kernel(a.data(), b.data(), out.data(), a.size());
+
+	double error = 0.0;
+	for (size_t i = 0; i < a.size(); i++) {
+		const double reference = _Op::Reference(a[i], b[i]);
+		const double difference = std::fabs(out[i] - reference);
+		error = std::max(error, _Op::Relative ? difference / std::fabs(reference) : difference);
+	}
+	return error;
+}
+
+static double MeasureThroughput(FastMathKernel *kernel, const std::vector<float> &a, const std::vector<float> &b) {
+	if (!kernel) return -1.0;
+
+	std::vector<float> out(a.size());
+	const uint64_t start = GetCurrentTimeMicros();
+	for (uint32_t repeat = 0; repeat < ThroughputRepeats; repeat++) {
+		kernel(a.data(), b.data(), out.data(), a.size());
+		KeepResult(out[repeat % out.size()]);
+	}
+	return GetNanosPerOp((uint64_t)ThroughputRepeats * a.size(), GetCurrentTimeMicros() - start);
+}
+
+static void PrintColumn(double value, const char *format) {
+	if (value < 0.0) std::printf("%10s", "-");
+	else std::printf(format, value);
+}
+
+template<typename _Op>
+static void MakeInputs(uint32_t count, std::vector<float> &a, std::vector<float> &b) {
+	a.assign(count, 0.0f);
+	b.assign(count, 0.0f);
+	for (uint32_t i = 0; i < count; i++) a[i] = _Op::GetInput(i, count, b[i]);
+}
+
+template<typename _Op>
+static void RunAccuracy() {
+	std::vector<float> a, b;
+	MakeInputs<_Op>(AccuracySamples, a, b);
+
+	for (FastMathPrecision precision : { FastMathPrecision::High, FastMathPrecision::Low }) {
+		const bool high = precision == FastMathPrecision::High;
+		const FastMathKernels kernels = high ? GetKernels<_Op, FastMathPrecision::High>() : GetKernels<_Op, FastMathPrecision::Low>();
+		const float bound = high ? _Op::HighBound : _Op::LowBound;
+		const double errors[] = {
+			MeasureError<_Op>(kernels.Scalar, a, b),
+			MeasureError<_Op>(kernels.SSE, a, b),
+			MeasureError<_Op>(kernels.AVX2, a, b),
+		};
+
+		std::printf("%-10s %-5s %10.2g", _Op::Name, high ? "High" : "Low", bound);
+		for (double error : errors) PrintColumn(error, "%10.2g");
+		std::printf("%s\n", _Op::Relative ? "  relative" : "");
+
+		for (double error : errors) {
+			Check(error <= bound, "FastMath error is above the documented maximum");
+		}
+	}
+}
+
+template<typename _Op>
+static void RunThroughput() {
+	std::vector<float> a, b;
+	MakeInputs<_Op>(ThroughputSamples, a, b);
+
+	for (FastMathPrecision precision : { FastMathPrecision::High, FastMathPrecision::Low }) {
+		const bool high = precision == FastMathPrecision::High;
+		const FastMathKernels kernels = high ? GetKernels<_Op, FastMathPrecision::High>() : GetKernels<_Op, FastMathPrecision::Low>();
+
+		std::printf("%-10s %-5s", _Op::Name, high ? "High" : "Low");
+		PrintColumn(high ? MeasureThroughput(RunLibm<_Op>, a, b) : -1.0, "%10.2f");
+		PrintColumn(MeasureThroughput(kernels.Scalar, a, b), "%10.2f");
+		PrintColumn(MeasureThroughput(kernels.SSE, a, b), "%10.2f");
+		PrintColumn(MeasureThroughput(kernels.AVX2, a, b), "%10.2f");
+		std::printf("\n");
+	}
+}
+
+void RunFastMathBenchmarks() {
+	std::printf("Max error against double precision libm\n");
+	std::printf("%-16s %10s %10s %10s %10s\n", "", "bound", "scalar", "SSE", "AVX2");
+	RunAccuracy<SinOp>();
+	RunAccuracy<CosOp>();
+	RunAccuracy<RSqrtOp>();
+	RunAccuracy<Atan2Op>();
+	RunAccuracy<ExpOp>();
+
+	std::printf("\nThroughput, ns per element\n");
+	std::printf("%-16s %10s %10s %10s %10s\n", "", "libm", "scalar", "SSE", "AVX2");
+	RunThroughput<SinOp>();
+	RunThroughput<CosOp>();
+	RunThroughput<RSqrtOp>();
+	RunThroughput<Atan2Op>();
+	RunThroughput<ExpOp>();
+}
\ No newline at end of file
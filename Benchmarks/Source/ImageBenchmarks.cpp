@@ -0,0 +1,89 @@
+#include "Benchmark.hpp"
+
+#include <Arcane/Graphics/Loader.hpp>
+#include <Arcane/System/AsyncFileIO.hpp>
+#include <Arcane/System/ThreadPool.hpp>
+#include <atomic>
+
+// Relative to the repository root, which the benchmarks are run from like
+// the game.
+static const char *sImagePaths[] = {
+	"Game/Assets/Materials/Wood Floor/WoodFloor_Color.png",
+	"Game/Assets/Materials/Wood Floor/WoodFloor_Roughness.png",
+	"Game/Assets/Materials/Wood Floor/WoodFloor_AmbientOcclusion.png",
+	"Game/Assets/Materials/Wood Floor/WoodFloor_Displacement.png",
+	"Game/Assets/Materials/Paving Stones/PavingStones_Color.png",
+	"Game/Assets/Materials/Paving Stones/PavingStones_Roughness.png",
+	"Game/Assets/Materials/Paving Stones/PavingStones_AmbientOcclusion.png",
+	"Game/Assets/Materials/Paving Stones/PavingStones_Displacement.png",
+};
+
+static constexpr uint32_t ImageCount = sizeof(sImagePaths) / sizeof(sImagePaths[0]);
+
+struct PendingImages {
+	ImageData Images[ImageCount];
+	std::atomic<uint32_t> Loaded;
+};
+
+struct PendingImage {
+	PendingImages *Owner;
+	uint32_t Index;
+};
+
+static void OnImageLoaded(ImageData &image, void *userData) {
+	PendingImage *pending = (PendingImage*)userData;
+	pending->Owner->Images[pending->Index] = image;
+	pending->Owner->Loaded.fetch_add(1, std::memory_order_release);
+}
+
+static bool IsValidImage(const ImageData &image) {
+	return image.Width > 0 && image.Height > 0 && image.Format == ImageFormat::RGB8 &&
+		image.Data.GetSize() == (size_t)image.Width * image.Height * 3;
+}
+
+// Loads every material texture one at a time through LoadImage(path), then
+// all at once through LoadImageAsync(), where reads and decodes overlap.
+void RunImageBenchmarks() {
+	InitThreadPool();
+	InitAsyncFileIO();
+
+	ImageData images[ImageCount];
+	const uint64_t blockingBegin = GetCurrentTimeMicros();
+	for (uint32_t i = 0; i < ImageCount; i++) {
+		images[i] = LoadImage(sImagePaths[i], ImageFormat::RGB8);
+	}
+	const uint64_t blockingMicros = GetCurrentTimeMicros() - blockingBegin;
+
+	for (uint32_t i = 0; i < ImageCount; i++) {
+		Check(IsValidImage(images[i]), "LoadImage returned an invalid image");
+	}
+
+	PendingImages pending{ {}, 0 };
+	PendingImage requests[ImageCount];
+	const uint64_t asyncBegin = GetCurrentTimeMicros();
+	for (uint32_t i = 0; i < ImageCount; i++) {
+		requests[i] = { &pending, i };
+		LoadImageAsync(sImagePaths[i], ImageFormat::RGB8, OnImageLoaded, &requests[i]);
+	}
+
+	ThreadPool &pool = GetThreadPool();
+	while (pending.Loaded.load(std::memory_order_acquire) < ImageCount) {
+		if (!pool.RunPendingTask()) Thread::Switch();
+	}
+	const uint64_t asyncMicros = GetCurrentTimeMicros() - asyncBegin;
+
+	for (uint32_t i = 0; i < ImageCount; i++) {
+		const ImageData &image = pending.Images[i];
+		Check(IsValidImage(image), "LoadImageAsync returned an invalid image");
+		Check(image.Width == images[i].Width && image.Height == images[i].Height, "LoadImage and LoadImageAsync disagree on an image's size");
+		Check(memcmp(image.Data.GetPointer(), images[i].Data.GetPointer(), image.Data.GetSize()) == 0, "LoadImage and LoadImageAsync disagree on an image's pixels");
+	}
+
+	std::printf("%u material textures as RGB8, %u workers\n", ImageCount, pool.GetWorkerCount());
+	std::printf("%-28s %10s\n", "", "total ms");
+	std::printf("%-28s %10.2f\n", "LoadImage, one at a time", blockingMicros / 1000.0);
+	std::printf("%-28s %10.2f\n", "LoadImageAsync, all at once", asyncMicros / 1000.0);
+
+	ShutdownAsyncFileIO();
+	ShutdownThreadPool();
+}
\ No newline at end of file
@@ -0,0 +1,49 @@
+#include "Benchmark.hpp"
+
+struct BenchmarkEntry {
+	const char *Name;
+	void(*Run)();
+};
+
+static const BenchmarkEntry sBenchmarks[] = {
+	{ "queue", RunQueueBenchmarks },
+	{ "mutex", RunMutexBenchmarks },
+	{ "allocator", RunAllocatorBenchmarks },
+	{ "container", RunContainerBenchmarks },
+	{ "matrix", RunMatrixBenchmarks },
+	{ "fastmath", RunFastMathBenchmarks },
+	{ "image", RunImageBenchmarks },
+};
+
+// Runs every benchmark, or only the ones named on the command line.
+int main(int argc, char **argv) {
+	for (int i = 1; i < argc; i++) {
+		bool found = false;
+		for (const BenchmarkEntry &entry : sBenchmarks) {
+			found |= strcmp(argv[i], entry.Name) == 0;
+		}
+
+		if (!found) {
+			std::printf("Unknown benchmark '%s'. Available:", argv[i]);
+			for (const BenchmarkEntry &entry : sBenchmarks) std::printf(" %s", entry.Name);
+			std::printf("\n");
+			return 1;
+		}
+	}
+
+	for (const BenchmarkEntry &entry : sBenchmarks) {
+		bool selected = argc == 1;
+		for (int i = 1; i < argc; i++) {
+			selected |= strcmp(argv[i], entry.Name) == 0;
+		}
+		if (!selected) continue;
+
+		std::printf("== %s ==\n", entry.Name);
+		entry.Run();
+		std::printf("\n");
+	}
+
+	const uint32_t failures = GetFailureCount();
+	if (failures > 0) std::printf("%u check(s) failed\n", failures);
+	return failures > 0 ? 1 : 0;
+}
\ No newline at end of file
@@ -0,0 +1,215 @@
+#include "Benchmark.hpp"
+
+#include <Arcane/Math/Math.hpp>
+#include <Arcane/Math/Matrix4.hpp>
+#include <vector>
+
+static constexpr uint32_t MatrixCount = 1024;
+static constexpr uint32_t MatrixRepeats = 2048;
+
+// Matrix4 as it was before it moved to SSE: plain row-major floats, and
+// Translate/Rotate/Scale as full 4x4 products. It never had an inverse,
+// so Inverse() follows the cofactor expansion of the AR_MATH_SCALAR path.
+struct ScalarMatrix4 {
+	float Data[4][4];
+
+	static ScalarMatrix4 From(const Matrix4 &m) {
+		ScalarMatrix4 result;
+		for (uint32_t i = 0; i < 4; i++) {
+			for (uint32_t j = 0; j < 4; j++) result.Data[i][j] = m.Data[i][j];
+		}
+		return result;
+	}
+
+	static ScalarMatrix4 Multiply(const ScalarMatrix4 &a, const ScalarMatrix4 &b) {
+		ScalarMatrix4 result;
+		for (uint32_t i = 0; i < 4; i++) {
+			for (uint32_t j = 0; j < 4; j++) {
+				float sum = 0.0f;
+				for (uint32_t k = 0; k < 4; k++) {
+					sum += a.Data[i][k] * b.Data[k][j];
+				}
+				result.Data[i][j] = sum;
+			}
+		}
+		return result;
+	}
+
+	static void Transform(const ScalarMatrix4 &m, const float v[4], float out[4]) {
+		for (uint32_t i = 0; i < 4; i++) {
+			float sum = 0.0f;
+			for (uint32_t k = 0; k < 4; k++) {
+				sum += m.Data[i][k] * v[k];
+			}
+			out[i] = sum;
+		}
+	}
+
+	static ScalarMatrix4 TranslateRotateScale(const ScalarMatrix4 &m, const Vector3 &translation, float angle, const Vector3 &scale) {
+		const float s = Sin(angle);
+		const float c = Cos(angle);
+		const ScalarMatrix4 translate = {{ { 1, 0, 0, translation.X }, { 0, 1, 0, translation.Y }, { 0, 0, 1, translation.Z }, { 0, 0, 0, 1 } }};
+		const ScalarMatrix4 rotate = {{ { c, -s, 0, 0 }, { s, c, 0, 0 }, { 0, 0, 1, 0 }, { 0, 0, 0, 1 } }};
+		const ScalarMatrix4 scaling = {{ { scale.X, 0, 0, 0 }, { 0, scale.Y, 0, 0 }, { 0, 0, scale.Z, 0 }, { 0, 0, 0, 1 } }};
+		return Multiply(Multiply(Multiply(m, translate), rotate), scaling);
+	}
+
+	static ScalarMatrix4 Inverse(const ScalarMatrix4 &m) {
+		const float (*d)[4] = m.Data;
+		const float s0 = d[0][0] * d[1][1] - d[1][0] * d[0][1];
+		const float s1 = d[0][0] * d[1][2] - d[1][0] * d[0][2];
+		const float s2 = d[0][0] * d[1][3] - d[1][0] * d[0][3];
+		const float s3 = d[0][1] * d[1][2] - d[1][1] * d[0][2];
+		const float s4 = d[0][1] * d[1][3] - d[1][1] * d[0][3];
+		const float s5 = d[0][2] * d[1][3] - d[1][2] * d[0][3];
+
+		const float c5 = d[2][2] * d[3][3] - d[3][2] * d[2][3];
+		const float c4 = d[2][1] * d[3][3] - d[3][1] * d[2][3];
+		const float c3 = d[2][1] * d[3][2] - d[3][1] * d[2][2];
+		const float c2 = d[2][0] * d[3][3] - d[3][0] * d[2][3];
+		const float c1 = d[2][0] * d[3][2] - d[3][0] * d[2][2];
+		const float c0 = d[2][0] * d[3][1] - d[3][0] * d[2][1];
+
+		const float invDet = 1.0f / (s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0);
+
+		return {{
+			{
+				( d[1][1] * c5 - d[1][2] * c4 + d[1][3] * c3) * invDet,
+				(-d[0][1] * c5 + d[0][2] * c4 - d[0][3] * c3) * invDet,
+				( d[3][1] * s5 - d[3][2] * s4 + d[3][3] * s3) * invDet,
+				(-d[2][1] * s5 + d[2][2] * s4 - d[2][3] * s3) * invDet
+			},
+			{
+				(-d[1][0] * c5 + d[1][2] * c2 - d[1][3] * c1) * invDet,
+				( d[0][0] * c5 - d[0][2] * c2 + d[0][3] * c1) * invDet,
+				(-d[3][0] * s5 + d[3][2] * s2 - d[3][3] * s1) * invDet,
+				( d[2][0] * s5 - d[2][2] * s2 + d[2][3] * s1) * invDet
+			},
+			{
+				( d[1][0] * c4 - d[1][1] * c2 + d[1][3] * c0) * invDet,
+				(-d[0][0] * c4 + d[0][1] * c2 - d[0][3] * c0) * invDet,
+				( d[3][0] * s4 - d[3][1] * s2 + d[3][3] * s0) * invDet,
+				(-d[2][0] * s4 + d[2][1] * s2 - d[2][3] * s0) * invDet
+			},
+			{
+				(-d[1][0] * c3 + d[1][1] * c1 - d[1][2] * c0) * invDet,
+				( d[0][0] * c3 - d[0][1] * c1 + d[0][2] * c0) * invDet,
+				(-d[3][0] * s3 + d[3][1] * s1 - d[3][2] * s0) * invDet,
+				( d[2][0] * s3 - d[2][1] * s1 + d[2][2] * s0) * invDet
+			}
+		}};
+	}
+};
+
+static float GetMaxDifference(const Matrix4 &a, const ScalarMatrix4 &b) {
+	float difference = 0.0f;
+	for (uint32_t i = 0; i < 4; i++) {
+		for (uint32_t j = 0; j < 4; j++) difference = std::max(difference, std::fabs(a.Data[i][j] - b.Data[i][j]));
+	}
+	return difference;
+}
+
+struct MatrixInputs {
+	std::vector<Matrix4> Matrices;
+	std::vector<ScalarMatrix4> ScalarMatrices;
+	std::vector<Vector4> Vectors;
+	std::vector<Vector3> Translations;
+	std::vector<float> Angles;
+};
+
+// Random rotations, scales and translations with a little noise on top,
+// so every matrix is well conditioned but has no zero elements.
+static MatrixInputs MakeMatrixInputs() {
+	MatrixInputs inputs;
+	uint32_t random = 0x2545F491u;
+	auto next = [&random]() {
+		random ^= random << 13;
+		random ^= random >> 17;
+		random ^= random << 5;
+		return (float)random / 4294967296.0f;
+	};
+
+	for (uint32_t i = 0; i < MatrixCount; i++) {
+		Matrix4 m = Matrix4::Identity();
+		m = Matrix4::Translate(m, Vector3(next() * 20 - 10, next() * 20 - 10, next() * 20 - 10));
+		m = Matrix4::RotateX(m, next() * 6.28f);
+		m = Matrix4::RotateY(m, next() * 6.28f);
+		m = Matrix4::Scale(m, Vector3(0.5f + next(), 0.5f + next(), 0.5f + next()));
+		for (uint32_t j = 0; j < 4; j++) {
+			for (uint32_t k = 0; k < 4; k++) m.Data[j][k] += (next() - 0.5f) * 0.01f;
+		}
+
+		inputs.Matrices.push_back(m);
+		inputs.ScalarMatrices.push_back(ScalarMatrix4::From(m));
+		inputs.Vectors.push_back(Vector4(next(), next(), next(), 1.0f));
+		inputs.Translations.push_back(Vector3(next(), next(), next()));
+		inputs.Angles.push_back(next() * 6.28f);
+	}
+	return inputs;
+}
+
+// Runs `body(index)` over every input MatrixRepeats times and returns ns
+// per call.
+template<typename _Body>
+static double TimeMatrixLoop(_Body body) {
+	const uint64_t start = GetCurrentTimeMicros();
+	for (uint32_t repeat = 0; repeat < MatrixRepeats; repeat++) {
+		for (uint32_t i = 0; i < MatrixCount; i++) body(i);
+	}
+	return GetNanosPerOp((uint64_t)MatrixRepeats * MatrixCount, GetCurrentTimeMicros() - start);
+}
+
+void RunMatrixBenchmarks() {
+	const MatrixInputs in = MakeMatrixInputs();
+	std::vector<Matrix4> results(MatrixCount);
+	std::vector<ScalarMatrix4> scalarResults(MatrixCount);
+	std::vector<Vector4> vectorResults(MatrixCount);
+	std::vector<Vector4> scalarVectorResults(MatrixCount);
+
+#if AR_MATH_SIMD
+	std::printf("Matrix4 is using SSE%s\n", AR_MATH_FMA ? " with FMA" : "");
+#else
+	std::printf("Matrix4 is using the scalar fallback (AR_MATH_SCALAR)\n");
+#endif
+	std::printf("%-24s %12s %12s\n", "ns per operation", "Matrix4", "previous");
+
+	auto next = [](uint32_t i) { return (i + 1) % MatrixCount; };
+	float error = 0.0f;
+
+	const double multiply = TimeMatrixLoop([&](uint32_t i) { results[i] = in.Matrices[i] * in.Matrices[next(i)]; KeepResult(results[i]); });
+	const double scalarMultiply = TimeMatrixLoop([&](uint32_t i) { scalarResults[i] = ScalarMatrix4::Multiply(in.ScalarMatrices[i], in.ScalarMatrices[next(i)]); KeepResult(scalarResults[i]); });
+	for (uint32_t i = 0; i < MatrixCount; i++) error = std::max(error, GetMaxDifference(results[i], scalarResults[i]));
+	std::printf("%-24s %12.2f %12.2f\n", "multiply", multiply, scalarMultiply);
+	Check(error < 1e-3f, "Matrix4 product does not match the scalar product");
+
+	const double transform = TimeMatrixLoop([&](uint32_t i) { vectorResults[i] = in.Matrices[i] * in.Vectors[next(i)]; KeepResult(vectorResults[i]); });
+	const double scalarTransform = TimeMatrixLoop([&](uint32_t i) { ScalarMatrix4::Transform(in.ScalarMatrices[i], in.Vectors[next(i)].Data, scalarVectorResults[i].Data); KeepResult(scalarVectorResults[i]); });
+	error = 0.0f;
+	for (uint32_t i = 0; i < MatrixCount; i++) {
+		for (uint32_t j = 0; j < 4; j++) error = std::max(error, std::fabs(vectorResults[i].Data[j] - scalarVectorResults[i].Data[j]));
+	}
+	std::printf("%-24s %12.2f %12.2f\n", "transform", transform, scalarTransform);
+	Check(error < 1e-3f, "Matrix4 transform does not match the scalar transform");
+
+	const double chain = TimeMatrixLoop([&](uint32_t i) {
+		results[i] = Matrix4::Scale(Matrix4::RotateZ(Matrix4::Translate(in.Matrices[i], in.Translations[i]), in.Angles[i]), in.Translations[next(i)]);
+		KeepResult(results[i]);
+	});
+	const double scalarChain = TimeMatrixLoop([&](uint32_t i) {
+		scalarResults[i] = ScalarMatrix4::TranslateRotateScale(in.ScalarMatrices[i], in.Translations[i], in.Angles[i], in.Translations[next(i)]);
+		KeepResult(scalarResults[i]);
+	});
+	error = 0.0f;
+	for (uint32_t i = 0; i < MatrixCount; i++) error = std::max(error, GetMaxDifference(results[i], scalarResults[i]));
+	std::printf("%-24s %12.2f %12.2f\n", "translate/rotate/scale", chain, scalarChain);
+	Check(error < 1e-3f, "Matrix4 Translate/RotateZ/Scale do not match the full products");
+
+	const double inverse = TimeMatrixLoop([&](uint32_t i) { results[i] = Matrix4::Inverse(in.Matrices[i]); KeepResult(results[i]); });
+	const double scalarInverse = TimeMatrixLoop([&](uint32_t i) { scalarResults[i] = ScalarMatrix4::Inverse(in.ScalarMatrices[i]); KeepResult(scalarResults[i]); });
+	error = 0.0f;
+	for (uint32_t i = 0; i < MatrixCount; i++) {
+		error = std::max(error, GetMaxDifference(in.Matrices[i] * results[i], ScalarMatrix4::From(Matrix4::Identity())));
+	}
+	std::printf("%-24s %12.2f %12.2f\n", "inverse", inverse, scalarInverse);
+	Check(error < 1e-3f, "Matrix4 times its inverse is not the identity");
+}
\ No newline at end of file
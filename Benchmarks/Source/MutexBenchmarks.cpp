@@ -0,0 +1,65 @@
+#include "Benchmark.hpp"
+
+#include <mutex>
+
+// Lock acquisitions per contended run, split across the threads.
+static constexpr uint64_t LockOps = 1 << 21;
+static constexpr uint64_t UncontendedLockOps = 1 << 24;
+
+class StdMutex {
+public:
+	inline void Lock() { mMutex.lock(); }
+	inline void Unlock() { mMutex.unlock(); }
+
+private:
+	std::mutex mMutex;
+};
+
+template<typename _Lock>
+struct LockRun {
+	_Lock *Lock;
+	uint64_t OpsPerThread;
+	// Only touched while the lock is held.
+	uint64_t Counter;
+};
+
+template<typename _Lock>
+static void LockThread(uint32_t, void *data) {
+	LockRun<_Lock> &run = *(LockRun<_Lock>*)data;
+	for (uint64_t i = 0; i < run.OpsPerThread; i++) {
+		run.Lock->Lock();
+		run.Counter++;
+		run.Lock->Unlock();
+	}
+}
+
+// Returns nanoseconds per lock/unlock pair, measured over all threads.
+template<typename _Lock>
+static double RunLock(_Lock &lock, uint32_t threads, uint64_t ops) {
+	LockRun<_Lock> run{ &lock, ops / threads, 0 };
+	const uint64_t micros = RunOnThreads(threads, LockThread<_Lock>, &run);
+
+	Check(run.Counter == run.OpsPerThread * threads, "Lock let two threads into the critical section");
+	return GetNanosPerOp(run.OpsPerThread * threads, micros);
+}
+
+void RunMutexBenchmarks() {
+	Mutex mutex = Mutex::Create();
+	StdMutex stdMutex;
+
+	std::printf("Uncontended lock/unlock, ns\n");
+	std::printf("%8s %12s %12s\n", "", "Mutex", "std::mutex");
+	std::printf("%8s %12.2f %12.2f\n", "",
+		RunLock(mutex, 1, UncontendedLockOps),
+		RunLock(stdMutex, 1, UncontendedLockOps)
+	);
+
+	std::printf("\nContended lock/increment/unlock, ns per acquisition\n");
+	std::printf("%8s %12s %12s\n", "threads", "Mutex", "std::mutex");
+	for (uint32_t threads : BenchmarkThreadCounts) {
+		std::printf("%8u %12.2f %12.2f\n", threads,
+			RunLock(mutex, threads, LockOps),
+			RunLock(stdMutex, threads, LockOps)
+		);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,138 @@
+#include "Benchmark.hpp"
+
+#include <Arcane/Data/Queue.hpp>
+#include <atomic>
+#include <deque>
+#include <mutex>
+
+// Items moved through the queue per run, split across the producers.
+static constexpr uint64_t QueueItems = 1 << 22;
+static constexpr size_t QueueCapacity = 1024;
+
+// Baseline the lock-free queues are meant to replace.
+class LockedQueue {
+public:
+	LockedQueue(size_t capacity) : mCapacity(capacity) { }
+
+	inline bool Push(uint64_t value) {
+		std::lock_guard<std::mutex> lock(mMutex);
+		if (mItems.size() == mCapacity) return false;
+		mItems.push_back(value);
+		return true;
+	}
+
+	inline bool Pop(uint64_t &out) {
+		std::lock_guard<std::mutex> lock(mMutex);
+		if (mItems.empty()) return false;
+		out = mItems.front();
+		mItems.pop_front();
+		return true;
+	}
+
+private:
+	std::mutex mMutex;
+	std::deque<uint64_t> mItems;
+	size_t mCapacity;
+};
+
+template<typename _Queue>
+struct QueueRun {
+	_Queue *Queue;
+	uint64_t ItemsPerProducer;
+	uint32_t Producers;
+	std::atomic<uint64_t> PushedSum;
+	std::atomic<uint64_t> PoppedSum;
+};
+
+template<typename _Queue>
+static void Produce(QueueRun<_Queue> &run, uint32_t producer, bool popOwn) {
+	uint64_t pushed = 0;
+	uint64_t popped = 0;
+
+	for (uint64_t i = 0; i < run.ItemsPerProducer; i++) {
+		const uint64_t value = producer * run.ItemsPerProducer + i + 1;
+		while (!run.Queue->Push(value)) Thread::Switch();
+		pushed += value;
+
+		// Every thread holds at most one item, so some item is always
+		// available to a thread that wants to pop.
+		if (popOwn) {
+			uint64_t out;
+			while (!run.Queue->Pop(out)) AR_CPU_PAUSE();
+			popped += out;
+		}
+	}
+
+	run.PushedSum.fetch_add(pushed, std::memory_order_relaxed);
+	run.PoppedSum.fetch_add(popped, std::memory_order_relaxed);
+}
+
+template<typename _Queue>
+static void AlternatingThread(uint32_t threadIndex, void *data) {
+	Produce(*(QueueRun<_Queue>*)data, threadIndex, true);
+}
+
+// Thread 0 is the only consumer.
+template<typename _Queue>
+static void ProducerConsumerThread(uint32_t threadIndex, void *data) {
+	QueueRun<_Queue> &run = *(QueueRun<_Queue>*)data;
+	if (threadIndex > 0) {
+		Produce(run, threadIndex - 1, false);
+		return;
+	}
+
+	const uint64_t total = run.ItemsPerProducer * run.Producers;
+	uint64_t popped = 0;
+	for (uint64_t i = 0; i < total; i++) {
+		uint64_t out;
+		while (!run.Queue->Pop(out)) Thread::Switch();
+		popped += out;
+	}
+	run.PoppedSum.fetch_add(popped, std::memory_order_relaxed);
+}
+
+// Returns millions of items per second, where an item is one push and
+// its matching pop.
+template<typename _Queue>
+static double RunQueue(uint32_t producers, bool alternating) {
+	_Queue queue(QueueCapacity);
+	QueueRun<_Queue> run;
+	run.Queue = &queue;
+	run.ItemsPerProducer = QueueItems / producers;
+	run.Producers = producers;
+	run.PushedSum.store(0);
+	run.PoppedSum.store(0);
+
+	const uint64_t micros = alternating
+		? RunOnThreads(producers, AlternatingThread<_Queue>, &run)
+		: RunOnThreads(producers + 1, ProducerConsumerThread<_Queue>, &run);
+
+	Check(run.PushedSum.load() == run.PoppedSum.load(), "Queue lost or duplicated items");
+	return GetMillionOpsPerSecond(run.ItemsPerProducer * producers, micros);
+}
+
+void RunQueueBenchmarks() {
+	std::printf("Every thread pushes then pops, M items/s\n");
+	std::printf("%8s %12s %12s\n", "threads", "MPMCQueue", "locked");
+	for (uint32_t threads : BenchmarkThreadCounts) {
+		std::printf("%8u %12.2f %12.2f\n", threads,
+			RunQueue<MPMCQueue<uint64_t>>(threads, true),
+			RunQueue<LockedQueue>(threads, true)
+		);
+	}
+
+	std::printf("\nProducers feeding one consumer, M items/s\n");
+	std::printf("%9s %12s %12s %12s %12s\n", "producers", "MPMCQueue", "MPSCQueue", "SPSCQueue", "locked");
+	for (uint32_t producers : BenchmarkThreadCounts) {
+		// SPSCQueue only allows a single producer.
+		char spsc[16] = "-";
+		if (producers == 1) std::snprintf(spsc, sizeof(spsc), "%.2f", RunQueue<SPSCQueue<uint64_t>>(1, false));
+
+		std::printf("%9u %12.2f %12.2f %12s %12.2f\n", producers,
+			RunQueue<MPMCQueue<uint64_t>>(producers, false),
+			RunQueue<MPSCQueue<uint64_t>>(producers, false),
+			spsc,
+			RunQueue<LockedQueue>(producers, false)
+		);
+	}
+}
\ No newline at end of file
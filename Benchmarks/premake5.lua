@@ -0,0 +1,55 @@
+project "Benchmarks"
+	kind "ConsoleApp"
+	language "C++"
+	cppdialect "C++20"
+
+	objdir "Binaries/Intermediate/%{cfg.buildcfg}"
+	targetdir "Binaries/Output/%{cfg.buildcfg}"
+
+	files {
+		"Source/**.cpp"
+	}
+
+	includedirs {
+		"Source",
+		"../Engine/Source",
+		"../Engine/Libraries/tracy/public"
+	}
+
+	libdirs {
+		os.getenv("VULKAN_SDK") .. "/Lib"
+	}
+
+	links {
+		"Engine",
+		"tracy",
+	}
+
+	filter "system:windows"
+		links {
+			"gdi32",
+			"opengl32",
+			"ws2_32",
+			"winmm",
+			"dbghelp",
+			"shlwapi",
+			"vulkan-1",
+		}
+
+	filter "system:linux"
+		links {
+			"pthread"
+		}
+
+	filter "configurations:Debug"
+		symbols "On"
+		defines {
+			"_DEBUG",
+			"TRACY_ENABLE"
+		}
+
+	filter "configurations:Release"
+		symbols "On"
+		defines {
+			"NDEBUG"
+		}
\ No newline at end of file
@@ -3,6 +3,13 @@
 #include <Arcane/Core.hpp>
 #include <Arcane/System/Time.hpp>
 #include <Arcane/System/Input.hpp>
+#include <Arcane/System/CPU.hpp>
+#include <Arcane/System/ThreadPool.hpp>
+#include <Arcane/System/TaskGraph.hpp>
+#include <Arcane/System/Arena.hpp>
+#include <Arcane/System/Memory.hpp>
+#include <Arcane/System/AsyncFileIO.hpp>
+#include <Arcane/System/FileWatcher.hpp>
 
 namespace Arcane {
 
@@ -11,6 +18,9 @@ namespace Arcane {
 		Application() { }
 		virtual ~Application() { }
 
+		// Adds loading work to the startup graph, which runs on the worker
+		// threads before Start(). Context tasks run on the main thread.
+		virtual void Load(TaskGraph &startup) { }
 		virtual void Start() { }
 		virtual void Update() { }
 		virtual void Render() { }
@@ -24,11 +34,35 @@ namespace Arcane {
 }
 
 int main(int argc, char **argv) {
+	Arcane::ReserveCore(Arcane::CoreRole::Main);
+	// Kept free for the render thread in case the application turns on
+	// pipelined rendering, which happens long after the workers exist.
+	Arcane::ReserveCore(Arcane::CoreRole::Render);
+	Arcane::InitThreadPool();
+	Arcane::InitAsyncFileIO();
+	Arcane::InitFileWatcher();
+	// Only pinned once the service threads exist, since they would inherit
+	// its affinity and share its core.
+	Arcane::PinToReservedCore(Arcane::Thread::GetCurrent(), Arcane::CoreRole::Main);
+
+	[[maybe_unused]] const uint64_t startupBegin = Arcane::GetCurrentTimeMicros();
 	Arcane::Application *app = Arcane::CreateApplication();
+	AR_ENGINE_INFO("Application created in {:.2f} ms", (Arcane::GetCurrentTimeMicros() - startupBegin) / 1000.0);
+
+	{
+		Arcane::TaskGraph startup;
+		app->Load(startup);
+		startup.Execute(Arcane::GetThreadPool());
+		startup.LogTimings("Startup");
+	}
+
 	app->Start();
+	AR_ENGINE_INFO("Startup finished in {:.2f} ms", (Arcane::GetCurrentTimeMicros() - startupBegin) / 1000.0);
 
 	while (app->IsRunning()) {
 		AR_PROFILE_FRAME_START();
+		Arcane::GetThreadPool().BeginFrame();
+
 		{
 			AR_PROFILE_SCOPE("Application::Update");
 			app->Update();
@@ -41,11 +75,19 @@ int main(int argc, char **argv) {
 
 		Arcane::UpdateInput();
 		Arcane::UpdateTime();
-		
+
+		Arcane::GetThreadPool().EndFrame();
+		Arcane::GetThreadScratch().Reset();
+		Arcane::GetFrameArena().Advance();
+		Arcane::AdvanceMemoryFrame();
 		AR_PROFILE_FRAME_END();
 	}
 
 	app->Stop();
 	Arcane::DestroyApplication(app);
+	Arcane::ShutdownFileWatcher();
+	Arcane::ShutdownAsyncFileIO();
+	Arcane::ShutdownThreadPool();
+	Arcane::ReportMemoryLeaks();
 	return 0;
 }
\ No newline at end of file
@@ -28,6 +28,11 @@
 #include <Arcane/System/Time.hpp>
 #include <Arcane/System/Thread.hpp>
 #include <Arcane/System/ThreadPool.hpp>
+#include <Arcane/System/CPU.hpp>
+#include <Arcane/System/Arena.hpp>
+#include <Arcane/System/TaskGraph.hpp>
+#include <Arcane/System/AsyncFileIO.hpp>
+#include <Arcane/System/FileWatcher.hpp>
 #include <Arcane/System/Socket.hpp>
 
 // PBR
@@ -1,6 +1,7 @@
 #include "Importer.hpp"
 
 #include <Arcane/Asset/Importers/GLBImporter.hpp>
+#include <Arcane/System/Memory.hpp>
 
 namespace Arcane {
 
@@ -9,6 +10,8 @@ namespace Arcane {
 	Importer::~Importer() { }
 
 	bool Importer::Import(const std::filesystem::path &path, uint32_t flags) {
+		MemoryTagScope tag(MemoryTag::Assets);
+
 		if (path.extension() == ".glb") {
 			return ImportGLB(path, flags, mNodes);
 		}
@@ -1,13 +1,18 @@
 #include "GLBImporter.hpp"
 
 #include <Arcane/Math/Matrix4.hpp>
+#include <Arcane/Math/Batch.hpp>
 #include <Arcane/Math/Quaternion.hpp>
 #include <Arcane/Util/StringUtils.hpp>
+#include <Arcane/Util/StringId.hpp>
 #include <Arcane/Util/ByteUtil.hpp>
 #include <Arcane/File/Json.hpp>
 #include <Arcane/Util/BufferView.hpp>
+#include <Arcane/Util/FileUtil.hpp>
 #include <Arcane/Graphics/Transform.hpp>
 
+#include <bit>
+
 namespace Arcane {
 
 	enum class GltfAttributeType {
@@ -40,15 +45,28 @@ namespace Arcane {
 		}
 	}
 
-	GltfAccessorElementType GetAccessorElementType(const std::string &element) {
-		if (element == "SCALAR") return GltfAccessorElementType::SCALAR;
-		else if (element == "VEC2") return GltfAccessorElementType::VEC2;
-		else if (element == "VEC3") return GltfAccessorElementType::VEC3;
-		else if (element == "VEC4") return GltfAccessorElementType::VEC4;
-		else if (element == "MAT2") return GltfAccessorElementType::MAT2;
-		else if (element == "MAT3") return GltfAccessorElementType::MAT3;
-		else if (element == "MAT4") return GltfAccessorElementType::MAT4;
-		return ((GltfAccessorElementType)UINT32_MAX);
+	GltfAccessorElementType GetAccessorElementType(StringId element) {
+		switch (element.GetHash()) {
+			case StringId("SCALAR").GetHash(): return GltfAccessorElementType::SCALAR;
+			case StringId("VEC2").GetHash(): return GltfAccessorElementType::VEC2;
+			case StringId("VEC3").GetHash(): return GltfAccessorElementType::VEC3;
+			case StringId("VEC4").GetHash(): return GltfAccessorElementType::VEC4;
+			case StringId("MAT2").GetHash(): return GltfAccessorElementType::MAT2;
+			case StringId("MAT3").GetHash(): return GltfAccessorElementType::MAT3;
+			case StringId("MAT4").GetHash(): return GltfAccessorElementType::MAT4;
+			default: return ((GltfAccessorElementType)UINT32_MAX);
+		}
+	}
+
+	GltfAttributeType GetAttributeType(StringId attribute) {
+		switch (attribute.GetHash()) {
+			case StringId("POSITION").GetHash(): return GltfAttributeType::POSITION;
+			case StringId("NORMAL").GetHash(): return GltfAttributeType::NORMAL;
+			case StringId("TANGENT").GetHash(): return GltfAttributeType::TANGENT;
+			case StringId("TEXCOORD_0").GetHash(): return GltfAttributeType::TEXCOORD_0;
+			case StringId("COLOR_0").GetHash(): return GltfAttributeType::COLOR_0;
+			default: return ((GltfAttributeType)UINT32_MAX);
+		}
 	}
 
 	GltfBufferTarget GetBufferTarget(uint32_t target) {
@@ -132,21 +150,26 @@ namespace Arcane {
 	};
 
 	bool ImportGLB(const std::filesystem::path &path, uint32_t flags, std::vector<Node> &outNodes) {
-		FILE *f = fopen(path.string().c_str(), "rb");
-		if (!f) {
+		// The whole file is mapped, so the JSON is parsed and the binary chunk
+		// is referenced straight from the page cache.
+		MappedFile file = MappedFile::Open(path.string(), FileAccessHint_Sequential | FileAccessHint_WillNeed);
+		if (!file || file.GetSize() < 20) {
 			AR_ASSERT(false, "Could not open file: {}\n", path.string().c_str());
 			return false;
 		}
 
+		const uint8_t *fileData = (const uint8_t*)file.GetPointer();
+		size_t fileOffset = 0;
+
 		uint32_t header[3];
-		fread(header, 4, 3, f);
+		std::memcpy(header, fileData, sizeof(header));
+		fileOffset += sizeof(header);
 		if (header[0] != 0x46546C67) {
 			AR_ASSERT(false, "{} is not a glTF file\n", path.string().c_str());
 			return false;
 		}
 
 		uint32_t chunkHeader[2];
-		void *chunkData;
 
 		GltfNodeDesc *nodeDescs;
 		uint32_t nodeCount;
@@ -163,15 +186,15 @@ namespace Arcane {
 		GltfBufferDesc *bufferDescs;
 		uint32_t bufferCount;
 
-		uint8_t *binaryData;
+		BufferRef binaryData;
 
-		fread(chunkHeader, 4, 2, f);
+		std::memcpy(chunkHeader, fileData + fileOffset, sizeof(chunkHeader));
+		fileOffset += sizeof(chunkHeader);
 		if (chunkHeader[1] == 0x4E4F534A) {
-			chunkData = malloc(chunkHeader[0] + 1);
-			memset(chunkData, 0, chunkHeader[0] + 1);
-			fread(chunkData, 1, chunkHeader[0], f);
+			AR_ASSERT(fileOffset + chunkHeader[0] <= file.GetSize(), "JSON chunk of {} is truncated\n", path.string().c_str());
 
-			JsonDocument doc = ParseJson((char*)chunkData);
+			JsonDocument doc = ParseJson((const char*)fileData + fileOffset, chunkHeader[0]);
+			fileOffset += chunkHeader[0];
 
 			const JsonValue &allNodes = doc["nodes"];
 			const JsonValue &allMeshes = doc["meshes"];
@@ -205,10 +228,10 @@ namespace Arcane {
 					q.X = node["rotation"][0].GetFloat();
 					q.Y = node["rotation"][1].GetFloat();
 					q.Z = node["rotation"][2].GetFloat();
-					q.W = ToDegrees(node["rotation"][3].GetFloat());
+					q.W = node["rotation"][3].GetFloat();
 				
-					transform.Rotation = q.ToEuler();
-					normalTransform.Rotation = q.ToEuler();
+					transform.Rotation = q;
+					normalTransform.Rotation = q;
 				}
 
 				if (node.HasMember("scale")) {
@@ -238,34 +261,16 @@ namespace Arcane {
 					
 					const JsonValue &attributes = primitive["attributes"];
 
-					if (attributes.HasMember("POSITION")) {
-						uint32_t attributeIndex = primitiveDesc.AttributeCount++;
-						primitiveDesc.Attributes[attributeIndex].Type = GltfAttributeType::POSITION;
-						primitiveDesc.Attributes[attributeIndex].AccessorIndex = attributes["POSITION"].GetUint();
-					}
-					
-					if (attributes.HasMember("NORMAL")) {
-						uint32_t attributeIndex = primitiveDesc.AttributeCount++;
-						primitiveDesc.Attributes[attributeIndex].Type = GltfAttributeType::NORMAL;
-						primitiveDesc.Attributes[attributeIndex].AccessorIndex = attributes["NORMAL"].GetUint();
-					}
-					
-					if (attributes.HasMember("TEXCOORD_0")) {
-						uint32_t attributeIndex = primitiveDesc.AttributeCount++;
-						primitiveDesc.Attributes[attributeIndex].Type = GltfAttributeType::TEXCOORD_0;
-						primitiveDesc.Attributes[attributeIndex].AccessorIndex = attributes["TEXCOORD_0"].GetUint();
-					}
-					
-					if (attributes.HasMember("TANGENT")) {
-						uint32_t attributeIndex = primitiveDesc.AttributeCount++;
-						primitiveDesc.Attributes[attributeIndex].Type = GltfAttributeType::TANGENT;
-						primitiveDesc.Attributes[attributeIndex].AccessorIndex = attributes["TANGENT"].GetUint();
-					}
-					
-					if (attributes.HasMember("COLOR_0")) {
+					// One pass over the attributes instead of a lookup per
+					// supported name. Others, like TEXCOORD_1, are skipped.
+					for (JsonValue::ConstMemberIterator it = attributes.MemberBegin(); it != attributes.MemberEnd(); ++it) {
+						const GltfAttributeType type = GetAttributeType(StringId(std::string_view(it->name.GetString(), it->name.GetStringLength())));
+						if (type == ((GltfAttributeType)UINT32_MAX)) continue;
+
+						AR_ASSERT(primitiveDesc.AttributeCount < 8, "Primitive has too many attributes");
 						uint32_t attributeIndex = primitiveDesc.AttributeCount++;
-						primitiveDesc.Attributes[attributeIndex].Type = GltfAttributeType::COLOR_0;
-						primitiveDesc.Attributes[attributeIndex].AccessorIndex = attributes["COLOR_0"].GetUint();
+						primitiveDesc.Attributes[attributeIndex].Type = type;
+						primitiveDesc.Attributes[attributeIndex].AccessorIndex = it->value.GetUint();
 					}
 
 					primitiveDesc.IndexBufferAccessor = primitive["indices"].GetUint();
@@ -288,7 +293,8 @@ namespace Arcane {
 				accessorDesc.ComponentType = GetComponentType(accessor["componentType"].GetUint());
 				accessorDesc.Normalized = accessor.HasMember("normalized") ? accessor["normalized"].GetBool() : false;
 				accessorDesc.Count = accessor["count"].GetUint();
-				accessorDesc.Type = GetAccessorElementType(accessor["type"].GetString());
+				const JsonValue &type = accessor["type"];
+				accessorDesc.Type = GetAccessorElementType(StringId(std::string_view(type.GetString(), type.GetStringLength())));
 			}
 
 			bufferViewCount = allBufferViews.Size();
@@ -317,14 +323,16 @@ namespace Arcane {
 				bufferDesc.ByteLength = buffer["byteLength"].GetUint();
 			}
 
-			free(chunkData);
 		}
 
-		fread(chunkHeader, 4, 2, f);
-		binaryData = (uint8_t*)malloc(chunkHeader[0]);
-		fread(binaryData, 1, chunkHeader[0], f);
+		AR_ASSERT(fileOffset + sizeof(chunkHeader) <= file.GetSize(), "{} has no binary chunk\n", path.string().c_str());
+		std::memcpy(chunkHeader, fileData + fileOffset, sizeof(chunkHeader));
+		fileOffset += sizeof(chunkHeader);
 
-		fclose(f);
+		// Slices of the mapping are read-only; everything that is converted
+		// or flipped below is copied into its own buffer first.
+		AR_ASSERT(fileOffset + chunkHeader[0] <= file.GetSize(), "Binary chunk of {} is truncated\n", path.string().c_str());
+		binaryData = file.Slice(fileOffset, chunkHeader[0]);
 
 		outNodes.resize(nodeCount);
 
@@ -346,51 +354,54 @@ namespace Arcane {
 					const GltfBufferViewDesc &bufferView = bufferViewDescs[accessor.BufferViewIndex];
 					const GltfBufferDesc &buffer = bufferDescs[bufferView.BufferIndex];
 
-					BufferView view(binaryData, bufferView.ByteOffset, bufferView.ByteLength);
+					BufferView view(binaryData.GetPointer(), bufferView.ByteOffset, bufferView.ByteLength);
 
 					if (attribute.Type == GltfAttributeType::POSITION) {
 						node.Mesh.VertexCount = accessor.Count;
 						node.Mesh.Positions = AllocateBuffer(accessor.Count * sizeof(Vector3));
 
 						if (accessor.ComponentType == GltfComponentType::FLOAT) {
+							Vector3 *positions = node.Mesh.Positions.GetPointerAs<Vector3>();
 							for (uint32_t componentIndex = 0; componentIndex < accessor.Count; componentIndex++) {
-								Vector4 transformed = nodeDescs[nodeIndex].Transform * Vector4(
-									-ToNativeEndian<Endianness::LittleEndian>(view.Next<float>()),
-									ToNativeEndian<Endianness::LittleEndian>(view.Next<float>()),
-									ToNativeEndian<Endianness::LittleEndian>(view.Next<float>()),
-									1.0
-								);
-
-								Vector3 position = { transformed.X, transformed.Y, transformed.Z };
-
-								if (flags & ImportFlag_GenerateBoundingBox) {
-									node.BoundingBox.Min = Vector3::Min(node.BoundingBox.Min, position);
-									node.BoundingBox.Max = Vector3::Max(node.BoundingBox.Max, position);
-								}
+								positions[componentIndex].X = -ToNativeEndian<Endianness::LittleEndian>(view.Next<float>());
+								positions[componentIndex].Y = ToNativeEndian<Endianness::LittleEndian>(view.Next<float>());
+								positions[componentIndex].Z = ToNativeEndian<Endianness::LittleEndian>(view.Next<float>());
+							}
 
-								node.Mesh.Positions.At<Vector3>(componentIndex) = position;
+							TransformPoints(nodeDescs[nodeIndex].Transform, positions, positions, accessor.Count);
+
+							if (flags & ImportFlag_GenerateBoundingBox) {
+								node.BoundingBox = ComputeAABB(positions, accessor.Count);
 							}
 						}
 					} else if (attribute.Type == GltfAttributeType::NORMAL) {
 						node.Mesh.Normals = AllocateBuffer(accessor.Count * sizeof(Vector3));
 
 						if (accessor.ComponentType == GltfComponentType::FLOAT) {
+							Vector3 *normals = node.Mesh.Normals.GetPointerAs<Vector3>();
 							for (uint32_t componentIndex = 0; componentIndex < accessor.Count; componentIndex++) {
-								Vector4 transformed = nodeDescs[nodeIndex].NormalTransform * Vector4(
-									-ToNativeEndian<Endianness::LittleEndian>(view.Next<float>()),
-									ToNativeEndian<Endianness::LittleEndian>(view.Next<float>()),
-									ToNativeEndian<Endianness::LittleEndian>(view.Next<float>()),
-									1.0
-								);
-
-								node.Mesh.Normals.At<Vector3>(componentIndex) = Vector3::Normalize({transformed.X, transformed.Y, transformed.Z });
+								normals[componentIndex].X = -ToNativeEndian<Endianness::LittleEndian>(view.Next<float>());
+								normals[componentIndex].Y = ToNativeEndian<Endianness::LittleEndian>(view.Next<float>());
+								normals[componentIndex].Z = ToNativeEndian<Endianness::LittleEndian>(view.Next<float>());
 							}
+
+							// The normal transform only rotates, so the translation column
+							// the old per-vertex code multiplied in was always zero.
+							TransformNormals(nodeDescs[nodeIndex].NormalTransform, normals, normals, accessor.Count);
 						}
 					} else if (attribute.Type == GltfAttributeType::TANGENT) {
 						node.Mesh.Tangents = AllocateBuffer(accessor.Count * sizeof(Vector3));
 						node.Mesh.Bitangents = AllocateBuffer(accessor.Count * sizeof(Vector3));
 
 					} else if (attribute.Type == GltfAttributeType::TEXCOORD_0) {
+						// Tightly packed little-endian floats are already in the layout
+						// the mesh expects, so they are referenced in place.
+						const bool packed = bufferView.ByteStride == UINT32_MAX || bufferView.ByteStride == sizeof(Vector2);
+						if (accessor.ComponentType == GltfComponentType::FLOAT && packed && !(flags & ImportFlag_FlipUVs) && std::endian::native == std::endian::little) {
+							node.Mesh.UVs = binaryData.Slice(bufferView.ByteOffset + accessor.ByteOffset, accessor.Count * sizeof(Vector2));
+							continue;
+						}
+
 						node.Mesh.UVs = AllocateBuffer(accessor.Count * sizeof(Vector2));
 
 						if (accessor.ComponentType == GltfComponentType::FLOAT) {
@@ -444,12 +455,16 @@ namespace Arcane {
 					const GltfBufferViewDesc &bufferView = bufferViewDescs[accessor.BufferViewIndex];
 					const GltfBufferDesc &buffer = bufferDescs[bufferView.BufferIndex];
 
-					BufferView view(binaryData, bufferView.ByteOffset, bufferView.ByteLength);
+					BufferView view(binaryData.GetPointer(), bufferView.ByteOffset, bufferView.ByteLength);
+
+					const bool inPlace = accessor.ComponentType == GltfComponentType::UNSIGNED_INT && !(flags & ImportFlag_SwapWindingOrder) && std::endian::native == std::endian::little;
 
-					node.Mesh.Indices = AllocateBuffer(accessor.Count * sizeof(uint32_t));
+					if (!inPlace) node.Mesh.Indices = AllocateBuffer(accessor.Count * sizeof(uint32_t));
 					node.Mesh.IndexCount = accessor.Count;
 
-					if (accessor.ComponentType == GltfComponentType::UNSIGNED_INT) {
+					if (inPlace) {
+						node.Mesh.Indices = binaryData.Slice(bufferView.ByteOffset + accessor.ByteOffset, accessor.Count * sizeof(uint32_t));
+					} else if (accessor.ComponentType == GltfComponentType::UNSIGNED_INT) {
 						for (uint32_t i = 0; i < accessor.Count; i += 3) {
 							if (flags & ImportFlag_SwapWindingOrder) {
 								node.Mesh.Indices.At<uint32_t>(i + 2) = ToNativeEndian<Endianness::LittleEndian>(view.Next<uint32_t>());
@@ -532,8 +547,6 @@ namespace Arcane {
 		delete[] bufferViewDescs;
 		delete[] bufferDescs;
 
-		free(binaryData);
-
 		return true;
 	}
 
@@ -21,17 +21,42 @@
 #	include <tracy/Tracy.hpp>
 #	define AR_PROFILE_FUNCTION() ZoneScopedN(__PRETTY_FUNCTION__)
 #	define AR_PROFILE_SCOPE(name) ZoneScopedN(name)
+#	define AR_PROFILE_DYNAMIC_SCOPE(name) ZoneScoped; ZoneName(name, strlen(name))
 #	define AR_PROFILE_FRAME_START() FrameMarkStart(nullptr)
 #	define AR_PROFILE_FRAME_END() FrameMarkEnd(nullptr)
+#	define AR_PROFILE_PLOT(name, value) TracyPlot(name, value)
+#	define AR_PROFILE_THREAD_NAME(name) ::tracy::SetThreadName(name)
+#	define AR_PROFILE_ALLOC(ptr, size) TracyAlloc(ptr, size)
+#	define AR_PROFILE_FREE(ptr) TracyFree(ptr)
+#	define AR_PROFILE_ALLOC_NAMED(ptr, size, name) TracyAllocN(ptr, size, name)
+#	define AR_PROFILE_FREE_NAMED(ptr, name) TracyFreeN(ptr, name)
 #else 
 #	define AR_PROFILE_FUNCTION()
 #	define AR_PROFILE_SCOPE(name)
+#	define AR_PROFILE_DYNAMIC_SCOPE(name)
 #	define AR_PROFILE_FRAME_START()
 #	define AR_PROFILE_FRAME_END()
+#	define AR_PROFILE_PLOT(name, value)
+#	define AR_PROFILE_THREAD_NAME(name)
+#	define AR_PROFILE_ALLOC(ptr, size)
+#	define AR_PROFILE_FREE(ptr)
+#	define AR_PROFILE_ALLOC_NAMED(ptr, size, name)
+#	define AR_PROFILE_FREE_NAMED(ptr, name)
 #endif
 
 #define AR_BIT(x) (1 << x)
 
+#define AR_CACHE_LINE_SIZE 64
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#	include <immintrin.h>
+#	define AR_CPU_PAUSE() _mm_pause()
+#elif defined(__aarch64__) || defined(__arm__)
+#	define AR_CPU_PAUSE() __asm__ __volatile__("yield")
+#else
+#	define AR_CPU_PAUSE()
+#endif
+
 #define AR_PTR_ADD(ptr, offset) ((void*)((uintptr_t)ptr + offset))
 
 #define AR_STRCAT(a, b) a##b
\ No newline at end of file
@@ -2,25 +2,54 @@
 
 #include <Arcane/System/Memory.hpp>
 
+#include <new>
+
 namespace Arcane {
 
-	BufferRef::BufferRef() : mData(nullptr) {}
+	BufferRef::BufferRef() : mData(nullptr), mPointer(nullptr), mSize(0) {}
 
-	BufferRef::BufferRef(BufferData *data) : mData(data) {
+	BufferRef::BufferRef(BufferData *data) : mData(data), mPointer(nullptr), mSize(0) {
 		if (!mData) return;
-		mData->RefCount++;
+		mData->RefCount.fetch_add(1, std::memory_order_relaxed);
+		mPointer = mData->Pointer;
+		mSize = mData->Size;
 	}
 
-	BufferRef::BufferRef(const BufferRef &other) : mData(other.mData) {
+	BufferRef::BufferRef(const BufferRef &other) : mData(other.mData), mPointer(other.mPointer), mSize(other.mSize) {
 		if (!other.mData) return;
-		mData->RefCount++;
+		mData->RefCount.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	BufferRef::BufferRef(BufferRef &&other) noexcept : mData(other.mData), mPointer(other.mPointer), mSize(other.mSize) {
+		other.mData = nullptr;
+		other.mPointer = nullptr;
+		other.mSize = 0;
 	}
 
 	BufferRef &BufferRef::operator=(const BufferRef &other) {
+		if (this == &other) return *this;
+
+		if (other.mData != nullptr) other.mData->RefCount.fetch_add(1, std::memory_order_relaxed);
 		Drop();
 
 		mData = other.mData;
-		if (mData != nullptr) mData->RefCount++;
+		mPointer = other.mPointer;
+		mSize = other.mSize;
+
+		return *this;
+	}
+
+	BufferRef &BufferRef::operator=(BufferRef &&other) noexcept {
+		if (this == &other) return *this;
+
+		Drop();
+
+		mData = other.mData;
+		mPointer = other.mPointer;
+		mSize = other.mSize;
+		other.mData = nullptr;
+		other.mPointer = nullptr;
+		other.mSize = 0;
 
 		return *this;
 	}
@@ -29,23 +58,67 @@ namespace Arcane {
 		Drop();
 	}
 
-	void BufferRef::Drop() {
-		if (!mData) return;
-		mData->RefCount--;
+	BufferRef BufferRef::Slice(size_t offset, size_t size) const {
+		AR_ASSERT(mData != nullptr, "BufferRef is not valid");
+		AR_ASSERT(offset <= mSize && size <= mSize - offset, "Slice is out of bounds");
 
-		if (mData->RefCount != 0) return;
-		
-		Free(mData->Pointer);
-		Free(mData);
+		BufferRef slice(*this);
+		slice.mPointer = AR_PTR_ADD(mPointer, offset);
+		slice.mSize = size;
+		return slice;
+	}
 
+	void BufferRef::Drop() {
+		BufferData *data = mData;
 		mData = nullptr;
+		mPointer = nullptr;
+		mSize = 0;
+
+		if (!data) return;
+		if (data->RefCount.fetch_sub(1, std::memory_order_release) != 1) return;
+
+		std::atomic_thread_fence(std::memory_order_acquire);
+
+		// Wrapped buffers have a header of their own; allocated ones share
+		// it with the payload.
+		if (data->Release != nullptr) {
+			data->Release(data);
+			std::destroy_at(data);
+			FreeObject(data);
+		} else {
+			std::destroy_at(data);
+			Free(data);
+		}
+	}
+
+	BufferRef AllocateBuffer(size_t size, size_t alignment) {
+		AR_ASSERT(alignment != 0 && (alignment & (alignment - 1)) == 0, "Buffer alignment must be a power of two");
+		if (alignment < alignof(BufferData)) alignment = alignof(BufferData);
+
+		// The payload starts at the first aligned address after the header;
+		// allocating `alignment - 1` extra bytes guarantees there is one.
+		uint8_t *memory = (uint8_t*)Allocate(sizeof(BufferData) + alignment - 1 + size);
+		const uintptr_t payload = ((uintptr_t)memory + sizeof(BufferData) + alignment - 1) & ~(uintptr_t)(alignment - 1);
+
+		BufferData *data = new (memory) BufferData();
+		data->RefCount.store(0, std::memory_order_relaxed);
+		data->Alignment = (uint32_t)alignment;
+		data->Size = size;
+		data->Pointer = (void*)payload;
+		data->Release = nullptr;
+		data->UserData = nullptr;
+
+		return BufferRef(data);
 	}
 
-	BufferRef AllocateBuffer(size_t size) {
-		BufferData *data = AllocateObject<BufferData>();
+	BufferRef WrapBuffer(void *pointer, size_t size, BufferReleaseFunc release, void *userData) {
+		BufferData *data = new (AllocateObject<BufferData>()) BufferData();
+		data->RefCount.store(0, std::memory_order_relaxed);
+		data->Alignment = 1;
 		data->Size = size;
-		data->RefCount = 0;
-		data->Pointer = Allocate(data->Size);
+		data->Pointer = pointer;
+		data->Release = release;
+		data->UserData = userData;
 
 		return BufferRef(data);
 	}
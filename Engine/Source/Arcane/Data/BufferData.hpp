@@ -1,27 +1,49 @@
 #pragma once
 
 #include <Arcane/Core.hpp>
+#include <atomic>
+
+#define AR_BUFFER_DEFAULT_ALIGNMENT 16
 
 namespace Arcane {
 
+	struct BufferData;
+
+	typedef void(*BufferReleaseFunc)(BufferData *data);
+
+	// Shared header of a buffer. Buffers made by AllocateBuffer() keep the
+	// payload in the same allocation, directly after the header; wrapped
+	// buffers point to external memory and hand it back through Release.
 	struct BufferData {
+		std::atomic<uint32_t> RefCount;
+		uint32_t Alignment;
 		size_t Size;
 		void *Pointer;
-		uint32_t RefCount;
+		BufferReleaseFunc Release;
+		void *UserData;
 	};
 
+	// Thread-safe handle to a range of a buffer. A slice shares the count of
+	// the buffer it was taken from, so the whole allocation stays alive for
+	// as long as any view into it exists.
 	class BufferRef {
 	public:
 		BufferRef();
 		BufferRef(BufferData *data);
 		BufferRef(const BufferRef &other);
+		BufferRef(BufferRef &&other) noexcept;
 		BufferRef &operator=(const BufferRef &other);
+		BufferRef &operator=(BufferRef &&other) noexcept;
 		~BufferRef();
 
-		inline void *GetPointer() { return mData ? mData->Pointer : nullptr; }
-		inline const void *GetPointer() const { return mData ? mData->Pointer : nullptr; }
-		inline size_t GetSize() const { return mData ? mData->Size : 0; }
-		inline uint32_t GetRefCount() const { return mData ? mData->RefCount : 0; }
+		inline void *GetPointer() { return mPointer; }
+		inline const void *GetPointer() const { return mPointer; }
+		inline size_t GetSize() const { return mSize; }
+		inline uint32_t GetRefCount() const { return mData ? mData->RefCount.load(std::memory_order_relaxed) : 0; }
+		inline BufferData *GetData() const { return mData; }
+
+		// True if this is a view into part of a larger buffer.
+		inline bool IsSlice() const { return mData != nullptr && (mPointer != mData->Pointer || mSize != mData->Size); }
 
 		template<typename _Type>
 		inline _Type *GetPointerAs() { return static_cast<_Type*>(GetPointer()); }
@@ -32,19 +54,31 @@ namespace Arcane {
 		template<typename _Type>
 		inline _Type &At(uint32_t index) {
 			AR_ASSERT(mData != nullptr, "BufferRef is not valid");
-			AR_ASSERT(index < mData->Size / sizeof(_Type), "Index out of bounds");
-			return reinterpret_cast<_Type*>(mData->Pointer)[index];
+			AR_ASSERT(index < mSize / sizeof(_Type), "Index out of bounds");
+			return reinterpret_cast<_Type*>(mPointer)[index];
 		}
 
-		inline void Drop();
+		// Returns a view of `size` bytes starting at `offset` without copying.
+		BufferRef Slice(size_t offset, size_t size) const;
+
+		void Drop();
 
 		inline bool IsValid() const { return mData != nullptr; }
 		inline operator bool() const { return IsValid(); }
 
 	private:
 		BufferData *mData;
+		void *mPointer;
+		size_t mSize;
 	};
-	
-	BufferRef AllocateBuffer(size_t size);
+
+	// Header and payload are a single allocation. `alignment` must be a
+	// power of two; use 64 for data that is streamed through SIMD code.
+	BufferRef AllocateBuffer(size_t size, size_t alignment = AR_BUFFER_DEFAULT_ALIGNMENT);
+
+	// Wraps memory that is owned elsewhere, e.g. a mapped file. `release` is
+	// called with the header once the last reference is dropped and must not
+	// free the header itself.
+	BufferRef WrapBuffer(void *pointer, size_t size, BufferReleaseFunc release, void *userData = nullptr);
 
 }
\ No newline at end of file
@@ -0,0 +1,430 @@
+#pragma once
+
+#include <Arcane/Core.hpp>
+#include "SmallVector.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <functional>
+#include <memory>
+#include <new>
+#include <utility>
+
+#define AR_HASH_MAP_MIN_CAPACITY 8
+
+namespace Arcane {
+
+	template<typename _Key, typename _Value>
+	struct HashMapEntry {
+		_Key Key;
+		_Value Value;
+	};
+
+	// Open-addressing hash map with Robin Hood probing. Entries sit in one
+	// flat array next to a byte per slot holding its distance from the
+	// home slot, so lookups scan linearly and stop as soon as they reach an
+	// entry that is closer to home than the key would be. Erasing shifts
+	// the following entries back instead of leaving tombstones. Inserting
+	// or erasing invalidates pointers to entries. Keys must not be modified.
+	template<typename _Key, typename _Value, typename _Hash = std::hash<_Key>, typename _Equal = std::equal_to<_Key>, typename _Allocator = std::allocator<HashMapEntry<_Key, _Value>>>
+	class HashMap {
+	public:
+		typedef HashMapEntry<_Key, _Value> Entry;
+
+		template<typename _MapType, typename _EntryType>
+		class BasicIterator {
+		public:
+			BasicIterator(_MapType *map, size_t index) : mMap(map), mIndex(index) { SkipEmpty(); }
+
+			inline _EntryType &operator*() const { return mMap->mEntries[mIndex]; }
+			inline _EntryType *operator->() const { return &mMap->mEntries[mIndex]; }
+
+			inline BasicIterator &operator++() {
+				mIndex++;
+				SkipEmpty();
+				return *this;
+			}
+
+			inline bool operator==(const BasicIterator &other) const { return mIndex == other.mIndex; }
+			inline bool operator!=(const BasicIterator &other) const { return mIndex != other.mIndex; }
+
+		private:
+			inline void SkipEmpty() {
+				while (mIndex < mMap->mCapacity && mMap->mDistances[mIndex] == 0) mIndex++;
+			}
+
+		private:
+			_MapType *mMap;
+			size_t mIndex;
+		};
+
+		typedef BasicIterator<HashMap, Entry> Iterator;
+		typedef BasicIterator<const HashMap, const Entry> ConstIterator;
+
+	public:
+		HashMap(const _Allocator &allocator = _Allocator()) : mAllocator(allocator), mEntries(nullptr), mDistances(nullptr), mCapacity(0), mSize(0), mShift(64) { }
+
+		HashMap(const HashMap &other) : HashMap(std::allocator_traits<_Allocator>::select_on_container_copy_construction(other.mAllocator)) {
+			CopyFrom(other);
+		}
+
+		HashMap(HashMap &&other) noexcept : HashMap(other.mAllocator) {
+			Swap(other);
+		}
+
+		~HashMap() {
+			Clear();
+			Deallocate(mEntries, mDistances, mCapacity);
+		}
+
+		HashMap &operator=(const HashMap &other) {
+			if (this == &other) return *this;
+
+			Clear();
+			CopyFrom(other);
+			return *this;
+		}
+
+		HashMap &operator=(HashMap &&other) noexcept {
+			if (this == &other) return *this;
+
+			Clear();
+			if (mAllocator == other.mAllocator) {
+				Swap(other);
+			} else {
+				for (Entry &entry : other) Insert(std::move(entry.Key), std::move(entry.Value));
+				other.Clear();
+			}
+			return *this;
+		}
+
+		// Returns false and leaves the map unchanged if the key already exists.
+		inline bool Insert(const _Key &key, const _Value &value) { return Emplace(key, value).second; }
+		inline bool Insert(_Key &&key, _Value &&value) { return Emplace(std::move(key), std::move(value)).second; }
+
+		// Returns the entry for the key and whether it was newly inserted.
+		template<typename _KeyArg, typename ..._Args>
+		std::pair<Entry*, bool> Emplace(_KeyArg &&key, _Args &&...args) {
+			const uint64_t hash = Hash(key);
+
+			const size_t found = FindIndex(key, hash);
+			if (found != SIZE_MAX) return { &mEntries[found], false };
+
+			if ((mSize + 1) * 8 > mCapacity * 7) Rehash(mCapacity == 0 ? AR_HASH_MAP_MIN_CAPACITY : mCapacity * 2);
+
+			const size_t index = InsertUnique(Entry{ _Key(std::forward<_KeyArg>(key)), _Value(std::forward<_Args>(args)...) }, hash);
+			mSize++;
+			return { &mEntries[index], true };
+		}
+
+		inline _Value &operator[](const _Key &key) { return Emplace(key).first->Value; }
+
+		inline _Value *Find(const _Key &key) {
+			const size_t index = FindIndex(key, Hash(key));
+			return index != SIZE_MAX ? &mEntries[index].Value : nullptr;
+		}
+
+		inline const _Value *Find(const _Key &key) const {
+			const size_t index = FindIndex(key, Hash(key));
+			return index != SIZE_MAX ? &mEntries[index].Value : nullptr;
+		}
+
+		inline bool Contains(const _Key &key) const { return FindIndex(key, Hash(key)) != SIZE_MAX; }
+
+		bool Erase(const _Key &key) {
+			size_t index = FindIndex(key, Hash(key));
+			if (index == SIZE_MAX) return false;
+
+			std::destroy_at(&mEntries[index]);
+
+			// Pull every following entry that is away from its home slot one
+			// step back, which keeps the probe sequences intact.
+			const size_t mask = mCapacity - 1;
+			size_t next = (index + 1) & mask;
+			while (mDistances[next] > 1) {
+				new (&mEntries[index]) Entry(std::move(mEntries[next]));
+				std::destroy_at(&mEntries[next]);
+				mDistances[index] = mDistances[next] - 1;
+
+				index = next;
+				next = (next + 1) & mask;
+			}
+
+			mDistances[index] = 0;
+			mSize--;
+			return true;
+		}
+
+		void Reserve(size_t count) {
+			if (count == 0) return;
+
+			const size_t capacity = std::bit_ceil((count * 8 + 6) / 7);
+			if (capacity > mCapacity) Rehash(capacity < AR_HASH_MAP_MIN_CAPACITY ? AR_HASH_MAP_MIN_CAPACITY : capacity);
+		}
+
+		void Clear() {
+			for (size_t i = 0; i < mCapacity; i++) {
+				if (mDistances[i] == 0) continue;
+				std::destroy_at(&mEntries[i]);
+				mDistances[i] = 0;
+			}
+			mSize = 0;
+		}
+
+		void Swap(HashMap &other) {
+			std::swap(mAllocator, other.mAllocator);
+			std::swap(mEntries, other.mEntries);
+			std::swap(mDistances, other.mDistances);
+			std::swap(mCapacity, other.mCapacity);
+			std::swap(mSize, other.mSize);
+			std::swap(mShift, other.mShift);
+		}
+
+		inline size_t GetSize() const { return mSize; }
+		inline size_t GetCapacity() const { return mCapacity; }
+		inline bool IsEmpty() const { return mSize == 0; }
+
+		inline Iterator begin() { return Iterator(this, 0); }
+		inline Iterator end() { return Iterator(this, mCapacity); }
+		inline ConstIterator begin() const { return ConstIterator(this, 0); }
+		inline ConstIterator end() const { return ConstIterator(this, mCapacity); }
+
+	private:
+		typedef typename std::allocator_traits<_Allocator>::template rebind_alloc<uint8_t> ByteAllocator;
+
+		// std::hash is the identity for integers on common standard
+		// libraries, so the result is mixed before taking the top bits.
+		inline uint64_t Hash(const _Key &key) const {
+			return (uint64_t)_Hash()(key) * 0x9E3779B97F4A7C15ull;
+		}
+
+		inline size_t GetHomeIndex(uint64_t hash) const { return (size_t)(hash >> mShift); }
+
+		size_t FindIndex(const _Key &key, uint64_t hash) const {
+			if (mSize == 0) return SIZE_MAX;
+
+			const size_t mask = mCapacity - 1;
+			size_t index = GetHomeIndex(hash);
+			uint32_t distance = 1;
+
+			while (mDistances[index] >= distance) {
+				if (mDistances[index] == distance && _Equal()(mEntries[index].Key, key)) return index;
+
+				index = (index + 1) & mask;
+				distance++;
+			}
+
+			return SIZE_MAX;
+		}
+
+		// Places an entry whose key is known to be absent. Richer entries,
+		// those closer to their home slot, are displaced further along.
+		size_t InsertUnique(Entry &&entry, uint64_t hash) {
+			const size_t mask = mCapacity - 1;
+			size_t index = GetHomeIndex(hash);
+			uint32_t distance = 1;
+			size_t result = SIZE_MAX;
+
+			Entry carried(std::move(entry));
+
+			while (true) {
+				AR_ASSERT(distance < UINT8_MAX, "HashMap probe sequence is too long, the hash function is likely poor");
+
+				if (mDistances[index] == 0) {
+					new (&mEntries[index]) Entry(std::move(carried));
+					mDistances[index] = (uint8_t)distance;
+					return result != SIZE_MAX ? result : index;
+				}
+
+				if (mDistances[index] < distance) {
+					std::swap(carried, mEntries[index]);
+
+					const uint32_t displaced = mDistances[index];
+					mDistances[index] = (uint8_t)distance;
+					distance = displaced;
+
+					if (result == SIZE_MAX) result = index;
+				}
+
+				index = (index + 1) & mask;
+				distance++;
+			}
+		}
+
+		void Rehash(size_t capacity) {
+			Entry *entries = mEntries;
+			uint8_t *distances = mDistances;
+			const size_t oldCapacity = mCapacity;
+
+			mEntries = std::allocator_traits<_Allocator>::allocate(mAllocator, capacity);
+			ByteAllocator byteAllocator(mAllocator);
+			mDistances = std::allocator_traits<ByteAllocator>::allocate(byteAllocator, capacity);
+			std::fill(mDistances, mDistances + capacity, (uint8_t)0);
+			mCapacity = capacity;
+			mShift = 64 - std::countr_zero(capacity);
+
+			for (size_t i = 0; i < oldCapacity; i++) {
+				if (distances[i] == 0) continue;
+
+				const uint64_t hash = Hash(entries[i].Key);
+				InsertUnique(std::move(entries[i]), hash);
+				std::destroy_at(&entries[i]);
+			}
+
+			Deallocate(entries, distances, oldCapacity);
+		}
+
+		void Deallocate(Entry *entries, uint8_t *distances, size_t capacity) {
+			if (capacity == 0) return;
+
+			std::allocator_traits<_Allocator>::deallocate(mAllocator, entries, capacity);
+			ByteAllocator byteAllocator(mAllocator);
+			std::allocator_traits<ByteAllocator>::deallocate(byteAllocator, distances, capacity);
+		}
+
+		void CopyFrom(const HashMap &other) {
+			Reserve(other.mSize);
+			for (const Entry &entry : other) Insert(entry.Key, entry.Value);
+		}
+
+	private:
+		[[no_unique_address]] _Allocator mAllocator;
+		Entry *mEntries;
+		uint8_t *mDistances;
+		size_t mCapacity;
+		size_t mSize;
+		uint32_t mShift;
+	};
+
+	struct HashSetEmpty { };
+
+	template<typename _Key, typename _Hash = std::hash<_Key>, typename _Equal = std::equal_to<_Key>, typename _Allocator = std::allocator<HashMapEntry<_Key, HashSetEmpty>>>
+	class HashSet {
+	public:
+		typedef HashMap<_Key, HashSetEmpty, _Hash, _Equal, _Allocator> MapType;
+
+		class ConstIterator {
+		public:
+			ConstIterator(typename MapType::ConstIterator iterator) : mIterator(iterator) { }
+
+			inline const _Key &operator*() const { return mIterator->Key; }
+			inline const _Key *operator->() const { return &mIterator->Key; }
+
+			inline ConstIterator &operator++() { ++mIterator; return *this; }
+			inline bool operator==(const ConstIterator &other) const { return mIterator == other.mIterator; }
+			inline bool operator!=(const ConstIterator &other) const { return mIterator != other.mIterator; }
+
+		private:
+			typename MapType::ConstIterator mIterator;
+		};
+
+	public:
+		HashSet(const _Allocator &allocator = _Allocator()) : mMap(allocator) { }
+
+		inline bool Insert(const _Key &key) { return mMap.Emplace(key).second; }
+		inline bool Insert(_Key &&key) { return mMap.Emplace(std::move(key)).second; }
+		inline bool Contains(const _Key &key) const { return mMap.Contains(key); }
+		inline bool Erase(const _Key &key) { return mMap.Erase(key); }
+
+		inline void Reserve(size_t count) { mMap.Reserve(count); }
+		inline void Clear() { mMap.Clear(); }
+
+		inline size_t GetSize() const { return mMap.GetSize(); }
+		inline bool IsEmpty() const { return mMap.IsEmpty(); }
+
+		inline ConstIterator begin() const { return ConstIterator(mMap.begin()); }
+		inline ConstIterator end() const { return ConstIterator(mMap.end()); }
+
+	private:
+		MapType mMap;
+	};
+
+	// Keys and values live in two contiguous arrays in insertion order, with
+	// a HashMap from key to array index. Iteration is a linear walk over the
+	// values; erasing moves the last element into the hole, so the order is
+	// not kept.
+	template<typename _Key, typename _Value, typename _Hash = std::hash<_Key>, typename _Equal = std::equal_to<_Key>>
+	class DenseMap {
+	public:
+		typedef _Value *Iterator;
+		typedef const _Value *ConstIterator;
+
+	public:
+		DenseMap() { }
+
+		// Returns false and leaves the map unchanged if the key already exists.
+		bool Insert(const _Key &key, const _Value &value) {
+			auto [entry, inserted] = mIndices.Emplace(key, (uint32_t)mValues.GetSize());
+			if (!inserted) return false;
+
+			mKeys.Push(key);
+			mValues.Push(value);
+			return true;
+		}
+
+		_Value &operator[](const _Key &key) {
+			auto [entry, inserted] = mIndices.Emplace(key, (uint32_t)mValues.GetSize());
+			if (inserted) {
+				mKeys.Push(key);
+				mValues.Emplace();
+			}
+			return mValues[entry->Value];
+		}
+
+		inline _Value *Find(const _Key &key) {
+			const uint32_t *index = mIndices.Find(key);
+			return index != nullptr ? &mValues[*index] : nullptr;
+		}
+
+		inline const _Value *Find(const _Key &key) const {
+			const uint32_t *index = mIndices.Find(key);
+			return index != nullptr ? &mValues[*index] : nullptr;
+		}
+
+		inline bool Contains(const _Key &key) const { return mIndices.Contains(key); }
+
+		bool Erase(const _Key &key) {
+			const uint32_t *found = mIndices.Find(key);
+			if (found == nullptr) return false;
+
+			const uint32_t index = *found;
+			const uint32_t last = (uint32_t)mValues.GetSize() - 1;
+			if (index != last) *mIndices.Find(mKeys[last]) = index;
+
+			mIndices.Erase(key);
+			mKeys.SwapErase(index);
+			mValues.SwapErase(index);
+			return true;
+		}
+
+		inline void Reserve(size_t count) {
+			mIndices.Reserve(count);
+			mKeys.Reserve(count);
+			mValues.Reserve(count);
+		}
+
+		inline void Clear() {
+			mIndices.Clear();
+			mKeys.Clear();
+			mValues.Clear();
+		}
+
+		inline size_t GetSize() const { return mValues.GetSize(); }
+		inline bool IsEmpty() const { return mValues.IsEmpty(); }
+
+		inline const _Key *GetKeys() const { return mKeys.GetData(); }
+		inline _Value *GetValues() { return mValues.GetData(); }
+		inline const _Value *GetValues() const { return mValues.GetData(); }
+
+		inline Iterator begin() { return mValues.begin(); }
+		inline Iterator end() { return mValues.end(); }
+		inline ConstIterator begin() const { return mValues.begin(); }
+		inline ConstIterator end() const { return mValues.end(); }
+
+	private:
+		HashMap<_Key, uint32_t, _Hash, _Equal> mIndices;
+		SmallVector<_Key, 0> mKeys;
+		SmallVector<_Value, 0> mValues;
+	};
+
+}
\ No newline at end of file
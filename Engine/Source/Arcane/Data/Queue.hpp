@@ -1,7 +1,292 @@
 #pragma once
 
+#include <Arcane/Core.hpp>
+#include <atomic>
+#include <bit>
+#include <new>
+
 namespace Arcane {
 
-	
+	// Bounded multi-producer/multi-consumer ring queue. Every cell carries a
+	// sequence number that tells producers and consumers whose turn it is, so
+	// a push or pop is a single CAS on the tail or head index.
+	template<typename _Type>
+	class MPMCQueue {
+	public:
+		MPMCQueue(size_t capacity) {
+			AR_ASSERT(capacity >= 2, "Queue capacity must be at least 2");
+			mCapacity = std::bit_ceil(capacity);
+			mMask = mCapacity - 1;
+			mCells = new Cell[mCapacity];
+			for (size_t i = 0; i < mCapacity; i++) {
+				mCells[i].Sequence.store(i, std::memory_order_relaxed);
+			}
+			mHead.store(0, std::memory_order_relaxed);
+			mTail.store(0, std::memory_order_relaxed);
+		}
+
+		MPMCQueue(const MPMCQueue &) = delete;
+		MPMCQueue &operator=(const MPMCQueue &) = delete;
+
+		~MPMCQueue() {
+			_Type value;
+			while (Pop(value)) { }
+			delete[] mCells;
+		}
+
+		inline bool Push(const _Type &value) { return Emplace(value); }
+		inline bool Push(_Type &&value) { return Emplace(std::move(value)); }
+
+		template<typename ..._Args>
+		bool Emplace(_Args &&...args) {
+			size_t position = mTail.load(std::memory_order_relaxed);
+			Cell *cell;
+
+			while (true) {
+				cell = &mCells[position & mMask];
+				const size_t sequence = cell->Sequence.load(std::memory_order_acquire);
+				const intptr_t difference = (intptr_t)sequence - (intptr_t)position;
+
+				if (difference == 0) {
+					if (mTail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) break;
+				} else if (difference < 0) {
+					return false;
+				} else {
+					position = mTail.load(std::memory_order_relaxed);
+				}
+			}
+
+			new (cell->Storage) _Type(std::forward<_Args>(args)...);
+			cell->Sequence.store(position + 1, std::memory_order_release);
+			return true;
+		}
+
+		bool Pop(_Type &out) {
+			size_t position = mHead.load(std::memory_order_relaxed);
+			Cell *cell;
+
+			while (true) {
+				cell = &mCells[position & mMask];
+				const size_t sequence = cell->Sequence.load(std::memory_order_acquire);
+				const intptr_t difference = (intptr_t)sequence - (intptr_t)(position + 1);
+
+				if (difference == 0) {
+					if (mHead.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) break;
+				} else if (difference < 0) {
+					return false;
+				} else {
+					position = mHead.load(std::memory_order_relaxed);
+				}
+			}
+
+			_Type *value = cell->GetPointer();
+			out = std::move(*value);
+			std::destroy_at(value);
+			cell->Sequence.store(position + mCapacity, std::memory_order_release);
+			return true;
+		}
+
+		inline size_t GetSize() const {
+			const size_t tail = mTail.load(std::memory_order_relaxed);
+			const size_t head = mHead.load(std::memory_order_relaxed);
+			return tail > head ? tail - head : 0;
+		}
+
+		inline bool IsEmpty() const { return GetSize() == 0; }
+		inline size_t GetCapacity() const { return mCapacity; }
+
+	private:
+		struct Cell {
+			std::atomic<size_t> Sequence;
+			alignas(_Type) uint8_t Storage[sizeof(_Type)];
+
+			inline _Type *GetPointer() { return std::launder(reinterpret_cast<_Type*>(Storage)); }
+		};
+
+	private:
+		alignas(AR_CACHE_LINE_SIZE) std::atomic<size_t> mHead;
+		alignas(AR_CACHE_LINE_SIZE) std::atomic<size_t> mTail;
+		alignas(AR_CACHE_LINE_SIZE) Cell *mCells;
+		size_t mCapacity;
+		size_t mMask;
+	};
+
+	// Bounded multi-producer/single-consumer queue. Producers claim cells the
+	// same way as MPMCQueue, but the single consumer owns the head index and
+	// never needs a CAS to pop.
+	template<typename _Type>
+	class MPSCQueue {
+	public:
+		MPSCQueue(size_t capacity) {
+			AR_ASSERT(capacity >= 2, "Queue capacity must be at least 2");
+			mCapacity = std::bit_ceil(capacity);
+			mMask = mCapacity - 1;
+			mCells = new Cell[mCapacity];
+			for (size_t i = 0; i < mCapacity; i++) {
+				mCells[i].Sequence.store(i, std::memory_order_relaxed);
+			}
+			mHead.store(0, std::memory_order_relaxed);
+			mTail.store(0, std::memory_order_relaxed);
+		}
+
+		MPSCQueue(const MPSCQueue &) = delete;
+		MPSCQueue &operator=(const MPSCQueue &) = delete;
+
+		~MPSCQueue() {
+			_Type value;
+			while (Pop(value)) { }
+			delete[] mCells;
+		}
+
+		inline bool Push(const _Type &value) { return Emplace(value); }
+		inline bool Push(_Type &&value) { return Emplace(std::move(value)); }
+
+		template<typename ..._Args>
+		bool Emplace(_Args &&...args) {
+			size_t position = mTail.load(std::memory_order_relaxed);
+			Cell *cell;
+
+			while (true) {
+				cell = &mCells[position & mMask];
+				const size_t sequence = cell->Sequence.load(std::memory_order_acquire);
+				const intptr_t difference = (intptr_t)sequence - (intptr_t)position;
+
+				if (difference == 0) {
+					if (mTail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) break;
+				} else if (difference < 0) {
+					return false;
+				} else {
+					position = mTail.load(std::memory_order_relaxed);
+				}
+			}
+
+			new (cell->Storage) _Type(std::forward<_Args>(args)...);
+			cell->Sequence.store(position + 1, std::memory_order_release);
+			return true;
+		}
+
+		// Must only be called from the consumer thread.
+		bool Pop(_Type &out) {
+			const size_t position = mHead.load(std::memory_order_relaxed);
+			Cell *cell = &mCells[position & mMask];
+
+			if (cell->Sequence.load(std::memory_order_acquire) != position + 1) return false;
+
+			_Type *value = cell->GetPointer();
+			out = std::move(*value);
+			std::destroy_at(value);
+			cell->Sequence.store(position + mCapacity, std::memory_order_release);
+			mHead.store(position + 1, std::memory_order_relaxed);
+			return true;
+		}
+
+		inline size_t GetSize() const {
+			const size_t tail = mTail.load(std::memory_order_relaxed);
+			const size_t head = mHead.load(std::memory_order_relaxed);
+			return tail > head ? tail - head : 0;
+		}
+
+		inline bool IsEmpty() const { return GetSize() == 0; }
+		inline size_t GetCapacity() const { return mCapacity; }
+
+	private:
+		struct Cell {
+			std::atomic<size_t> Sequence;
+			alignas(_Type) uint8_t Storage[sizeof(_Type)];
+
+			inline _Type *GetPointer() { return std::launder(reinterpret_cast<_Type*>(Storage)); }
+		};
+
+	private:
+		alignas(AR_CACHE_LINE_SIZE) std::atomic<size_t> mHead;
+		alignas(AR_CACHE_LINE_SIZE) std::atomic<size_t> mTail;
+		alignas(AR_CACHE_LINE_SIZE) Cell *mCells;
+		size_t mCapacity;
+		size_t mMask;
+	};
+
+	// Bounded single-producer/single-consumer queue. Each side keeps a cached
+	// copy of the other side's index and only re-reads the shared one when the
+	// queue looks full or empty, so the common case touches no shared cache line.
+	template<typename _Type>
+	class SPSCQueue {
+	public:
+		SPSCQueue(size_t capacity) {
+			AR_ASSERT(capacity >= 2, "Queue capacity must be at least 2");
+			mCapacity = std::bit_ceil(capacity);
+			mMask = mCapacity - 1;
+			mSlots = new Slot[mCapacity];
+			mHead.store(0, std::memory_order_relaxed);
+			mTail.store(0, std::memory_order_relaxed);
+			mCachedHead = 0;
+			mCachedTail = 0;
+		}
+
+		SPSCQueue(const SPSCQueue &) = delete;
+		SPSCQueue &operator=(const SPSCQueue &) = delete;
+
+		~SPSCQueue() {
+			_Type value;
+			while (Pop(value)) { }
+			delete[] mSlots;
+		}
+
+		inline bool Push(const _Type &value) { return Emplace(value); }
+		inline bool Push(_Type &&value) { return Emplace(std::move(value)); }
+
+		// Must only be called from the producer thread.
+		template<typename ..._Args>
+		bool Emplace(_Args &&...args) {
+			const size_t tail = mTail.load(std::memory_order_relaxed);
+			if (tail - mCachedHead == mCapacity) {
+				mCachedHead = mHead.load(std::memory_order_acquire);
+				if (tail - mCachedHead == mCapacity) return false;
+			}
+
+			new (mSlots[tail & mMask].Storage) _Type(std::forward<_Args>(args)...);
+			mTail.store(tail + 1, std::memory_order_release);
+			return true;
+		}
+
+		// Must only be called from the consumer thread.
+		bool Pop(_Type &out) {
+			const size_t head = mHead.load(std::memory_order_relaxed);
+			if (head == mCachedTail) {
+				mCachedTail = mTail.load(std::memory_order_acquire);
+				if (head == mCachedTail) return false;
+			}
+
+			_Type *value = mSlots[head & mMask].GetPointer();
+			out = std::move(*value);
+			std::destroy_at(value);
+			mHead.store(head + 1, std::memory_order_release);
+			return true;
+		}
+
+		inline size_t GetSize() const {
+			const size_t tail = mTail.load(std::memory_order_relaxed);
+			const size_t head = mHead.load(std::memory_order_relaxed);
+			return tail > head ? tail - head : 0;
+		}
+
+		inline bool IsEmpty() const { return GetSize() == 0; }
+		inline size_t GetCapacity() const { return mCapacity; }
+
+	private:
+		struct Slot {
+			alignas(_Type) uint8_t Storage[sizeof(_Type)];
+
+			inline _Type *GetPointer() { return std::launder(reinterpret_cast<_Type*>(Storage)); }
+		};
+
+	private:
+		alignas(AR_CACHE_LINE_SIZE) std::atomic<size_t> mHead;
+		size_t mCachedTail;
+		alignas(AR_CACHE_LINE_SIZE) std::atomic<size_t> mTail;
+		size_t mCachedHead;
+		alignas(AR_CACHE_LINE_SIZE) Slot *mSlots;
+		size_t mCapacity;
+		size_t mMask;
+	};
 
 }
\ No newline at end of file
@@ -0,0 +1,312 @@
+#pragma once
+
+#include <Arcane/Core.hpp>
+#include <algorithm>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace Arcane {
+
+	// Dynamic array that keeps up to _InlineCount elements inside the object
+	// and only moves to allocator memory once it grows past that. With an
+	// inline count of 0 it is a plain vector over _Allocator.
+	template<typename _Type, size_t _InlineCount, typename _Allocator = std::allocator<_Type>>
+	class SmallVector {
+	public:
+		typedef _Type *Iterator;
+		typedef const _Type *ConstIterator;
+
+	public:
+		SmallVector(const _Allocator &allocator = _Allocator()) : mAllocator(allocator), mData(GetInline()), mSize(0), mCapacity(_InlineCount) { }
+
+		SmallVector(std::initializer_list<_Type> values, const _Allocator &allocator = _Allocator()) : SmallVector(allocator) {
+			Reserve(values.size());
+			for (const _Type &value : values) new (mData + mSize++) _Type(value);
+		}
+
+		SmallVector(const SmallVector &other) : SmallVector(std::allocator_traits<_Allocator>::select_on_container_copy_construction(other.mAllocator)) {
+			Reserve(other.mSize);
+			std::uninitialized_copy(other.begin(), other.end(), mData);
+			mSize = other.mSize;
+		}
+
+		SmallVector(SmallVector &&other) noexcept : SmallVector(other.mAllocator) {
+			MoveFrom(other);
+		}
+
+		~SmallVector() {
+			Clear();
+			ReleaseHeap();
+		}
+
+		SmallVector &operator=(const SmallVector &other) {
+			if (this == &other) return *this;
+
+			Clear();
+			Reserve(other.mSize);
+			std::uninitialized_copy(other.begin(), other.end(), mData);
+			mSize = other.mSize;
+			return *this;
+		}
+
+		SmallVector &operator=(SmallVector &&other) noexcept {
+			if (this == &other) return *this;
+
+			Clear();
+			MoveFrom(other);
+			return *this;
+		}
+
+		inline void Push(const _Type &value) { Emplace(value); }
+		inline void Push(_Type &&value) { Emplace(std::move(value)); }
+
+		template<typename ..._Args>
+		_Type &Emplace(_Args &&...args) {
+			if (mSize < mCapacity) return *new (mData + mSize++) _Type(std::forward<_Args>(args)...);
+
+			// The new element is constructed before the old ones are moved,
+			// so arguments that refer into this vector stay valid.
+			const size_t capacity = mCapacity * 2 > mSize + 1 ? mCapacity * 2 : mSize + 1;
+			_Type *data = std::allocator_traits<_Allocator>::allocate(mAllocator, capacity);
+			new (data + mSize) _Type(std::forward<_Args>(args)...);
+			Relocate(data, capacity);
+
+			return mData[mSize++];
+		}
+
+		inline void Pop() {
+			AR_ASSERT(mSize > 0, "Cannot pop from an empty SmallVector");
+			std::destroy_at(mData + --mSize);
+		}
+
+		// Keeps the order of the remaining elements.
+		void Erase(size_t index) {
+			AR_ASSERT(index < mSize, "Index out of bounds");
+			std::move(mData + index + 1, mData + mSize, mData + index);
+			std::destroy_at(mData + --mSize);
+		}
+
+		// Moves the last element into the hole instead of shifting.
+		void SwapErase(size_t index) {
+			AR_ASSERT(index < mSize, "Index out of bounds");
+			if (index != mSize - 1) mData[index] = std::move(mData[mSize - 1]);
+			std::destroy_at(mData + --mSize);
+		}
+
+		void Resize(size_t size) {
+			Reserve(size);
+			while (mSize < size) new (mData + mSize++) _Type();
+			while (mSize > size) std::destroy_at(mData + --mSize);
+		}
+
+		void Resize(size_t size, const _Type &value) {
+			Reserve(size);
+			while (mSize < size) new (mData + mSize++) _Type(value);
+			while (mSize > size) std::destroy_at(mData + --mSize);
+		}
+
+		void Reserve(size_t capacity) {
+			if (capacity <= mCapacity) return;
+			Relocate(std::allocator_traits<_Allocator>::allocate(mAllocator, capacity), capacity);
+		}
+
+		inline void Clear() {
+			std::destroy(mData, mData + mSize);
+			mSize = 0;
+		}
+
+		inline _Type &operator[](size_t index) {
+			AR_ASSERT(index < mSize, "Index out of bounds");
+			return mData[index];
+		}
+
+		inline const _Type &operator[](size_t index) const {
+			AR_ASSERT(index < mSize, "Index out of bounds");
+			return mData[index];
+		}
+
+		inline _Type &GetFront() { return (*this)[0]; }
+		inline const _Type &GetFront() const { return (*this)[0]; }
+		inline _Type &GetBack() { return (*this)[mSize - 1]; }
+		inline const _Type &GetBack() const { return (*this)[mSize - 1]; }
+
+		inline _Type *GetData() { return mData; }
+		inline const _Type *GetData() const { return mData; }
+		inline size_t GetSize() const { return mSize; }
+		inline size_t GetCapacity() const { return mCapacity; }
+		inline bool IsEmpty() const { return mSize == 0; }
+		inline bool IsInline() const { return mData == GetInline(); }
+		inline const _Allocator &GetAllocator() const { return mAllocator; }
+
+		inline Iterator begin() { return mData; }
+		inline Iterator end() { return mData + mSize; }
+		inline ConstIterator begin() const { return mData; }
+		inline ConstIterator end() const { return mData + mSize; }
+
+	private:
+		inline _Type *GetInline() { return std::launder(reinterpret_cast<_Type*>(mInline)); }
+		inline const _Type *GetInline() const { return std::launder(reinterpret_cast<const _Type*>(mInline)); }
+
+		// Moves the elements into `data` and releases the old heap storage.
+		void Relocate(_Type *data, size_t capacity) {
+			std::uninitialized_move(mData, mData + mSize, data);
+			std::destroy(mData, mData + mSize);
+			ReleaseHeap();
+
+			mData = data;
+			mCapacity = capacity;
+		}
+
+		inline void ReleaseHeap() {
+			if (!IsInline()) std::allocator_traits<_Allocator>::deallocate(mAllocator, mData, mCapacity);
+			mData = GetInline();
+			mCapacity = _InlineCount;
+		}
+
+		// Expects this vector to be empty. Heap storage is taken over when
+		// both sides share an allocator; inline elements are moved one by one.
+		void MoveFrom(SmallVector &other) {
+			if (!other.IsInline() && mAllocator == other.mAllocator) {
+				ReleaseHeap();
+				mData = other.mData;
+				mSize = other.mSize;
+				mCapacity = other.mCapacity;
+
+				other.mData = other.GetInline();
+				other.mSize = 0;
+				other.mCapacity = _InlineCount;
+				return;
+			}
+
+			Reserve(other.mSize);
+			std::uninitialized_move(other.begin(), other.end(), mData);
+			mSize = other.mSize;
+			other.Clear();
+		}
+
+	private:
+		[[no_unique_address]] _Allocator mAllocator;
+		_Type *mData;
+		size_t mSize;
+		size_t mCapacity;
+		alignas(_Type) uint8_t mInline[_InlineCount > 0 ? _InlineCount * sizeof(_Type) : 1];
+	};
+
+	// Vector with a fixed capacity and no heap storage at all. Pushing past
+	// the capacity is an error.
+	template<typename _Type, size_t _Capacity>
+	class FixedVector {
+	public:
+		typedef _Type *Iterator;
+		typedef const _Type *ConstIterator;
+
+	public:
+		FixedVector() : mSize(0) { }
+
+		FixedVector(std::initializer_list<_Type> values) : mSize(0) {
+			AR_ASSERT(values.size() <= _Capacity, "FixedVector capacity exceeded");
+			for (const _Type &value : values) new (GetData() + mSize++) _Type(value);
+		}
+
+		FixedVector(const FixedVector &other) : mSize(other.mSize) {
+			std::uninitialized_copy(other.begin(), other.end(), GetData());
+		}
+
+		FixedVector(FixedVector &&other) noexcept : mSize(other.mSize) {
+			std::uninitialized_move(other.begin(), other.end(), GetData());
+			other.Clear();
+		}
+
+		~FixedVector() { Clear(); }
+
+		FixedVector &operator=(const FixedVector &other) {
+			if (this == &other) return *this;
+
+			Clear();
+			std::uninitialized_copy(other.begin(), other.end(), GetData());
+			mSize = other.mSize;
+			return *this;
+		}
+
+		FixedVector &operator=(FixedVector &&other) noexcept {
+			if (this == &other) return *this;
+
+			Clear();
+			std::uninitialized_move(other.begin(), other.end(), GetData());
+			mSize = other.mSize;
+			other.Clear();
+			return *this;
+		}
+
+		inline void Push(const _Type &value) { Emplace(value); }
+		inline void Push(_Type &&value) { Emplace(std::move(value)); }
+
+		template<typename ..._Args>
+		inline _Type &Emplace(_Args &&...args) {
+			AR_ASSERT(mSize < _Capacity, "FixedVector capacity exceeded");
+			return *new (GetData() + mSize++) _Type(std::forward<_Args>(args)...);
+		}
+
+		inline void Pop() {
+			AR_ASSERT(mSize > 0, "Cannot pop from an empty FixedVector");
+			std::destroy_at(GetData() + --mSize);
+		}
+
+		void Erase(size_t index) {
+			AR_ASSERT(index < mSize, "Index out of bounds");
+			std::move(GetData() + index + 1, GetData() + mSize, GetData() + index);
+			std::destroy_at(GetData() + --mSize);
+		}
+
+		void SwapErase(size_t index) {
+			AR_ASSERT(index < mSize, "Index out of bounds");
+			if (index != mSize - 1) GetData()[index] = std::move(GetData()[mSize - 1]);
+			std::destroy_at(GetData() + --mSize);
+		}
+
+		void Resize(size_t size) {
+			AR_ASSERT(size <= _Capacity, "FixedVector capacity exceeded");
+			while (mSize < size) new (GetData() + mSize++) _Type();
+			while (mSize > size) std::destroy_at(GetData() + --mSize);
+		}
+
+		inline void Clear() {
+			std::destroy(GetData(), GetData() + mSize);
+			mSize = 0;
+		}
+
+		inline _Type &operator[](size_t index) {
+			AR_ASSERT(index < mSize, "Index out of bounds");
+			return GetData()[index];
+		}
+
+		inline const _Type &operator[](size_t index) const {
+			AR_ASSERT(index < mSize, "Index out of bounds");
+			return GetData()[index];
+		}
+
+		inline _Type &GetFront() { return (*this)[0]; }
+		inline const _Type &GetFront() const { return (*this)[0]; }
+		inline _Type &GetBack() { return (*this)[mSize - 1]; }
+		inline const _Type &GetBack() const { return (*this)[mSize - 1]; }
+
+		inline _Type *GetData() { return std::launder(reinterpret_cast<_Type*>(mStorage)); }
+		inline const _Type *GetData() const { return std::launder(reinterpret_cast<const _Type*>(mStorage)); }
+		inline size_t GetSize() const { return mSize; }
+		inline constexpr size_t GetCapacity() const { return _Capacity; }
+		inline bool IsEmpty() const { return mSize == 0; }
+		inline bool IsFull() const { return mSize == _Capacity; }
+
+		inline Iterator begin() { return GetData(); }
+		inline Iterator end() { return GetData() + mSize; }
+		inline ConstIterator begin() const { return GetData(); }
+		inline ConstIterator end() const { return GetData() + mSize; }
+
+	private:
+		size_t mSize;
+		alignas(_Type) uint8_t mStorage[_Capacity * sizeof(_Type)];
+	};
+
+}
\ No newline at end of file
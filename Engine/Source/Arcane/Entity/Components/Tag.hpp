@@ -1,14 +1,16 @@
 #pragma once
 
 #include <Arcane/Core.hpp>
+#include <Arcane/Util/StringId.hpp>
 
 namespace Arcane {
 	
 	struct Tag {
 		Tag() { }
-		Tag(const std::string &tag) : Name(tag) { }
+		Tag(StringId tag) : Name(tag) { }
+		Tag(std::string_view tag) : Name(StringId::Intern(tag)) { }
 	
-		std::string Name;
+		StringId Name;
 	};
 
 }
\ No newline at end of file
@@ -1,9 +1,10 @@
 #pragma once
 
 #include <Arcane/Core.hpp>
+#include <Arcane/System/Memory.hpp>
+#include <array>
 #include <bitset>
 #include <queue>
-#include <functional>
 
 #define AR_MAX_ENTITIES 1024
 #define AR_MAX_COMPONENTS 64
@@ -26,12 +27,12 @@ namespace Arcane {
 	public:
 		ComponentPool() : mData(nullptr), mElementSize(0) { }
 		ComponentPool(size_t componentSize) : mElementSize(componentSize) {
-			mData = malloc(componentSize * AR_MAX_ENTITIES);
+			mData = Allocate(componentSize * AR_MAX_ENTITIES, MemoryTag::ECS);
 			std::memset(mData, 0, componentSize * AR_MAX_ENTITIES);
 		}
 
 		~ComponentPool() {
-			free(mData);
+			if (mData != nullptr) Free(mData);
 		}
 
 		inline void *GetComponent(uint32_t index) {
@@ -89,50 +90,26 @@ namespace Arcane {
 
 		template<typename ..._Types>
 		EntityID FindEntity() const {
-			const uint32_t componentCount = sizeof...(_Types);
-			const ComponentID componentIDs[] = { GetComponentID<_Types>()... };
-			std::bitset<AR_MAX_COMPONENTS> mask;
-			for (uint32_t i = 1; i < componentCount; i++) {
-				mask.set(componentIDs[i]);
-			}
+			const std::bitset<AR_MAX_COMPONENTS> mask = GetComponentMask<_Types...>();
 
-			bool found = false;
-			EntityID entity = 0;
-
-			while (entity <= mMaxEntityID) {
-				if (!IsEntity(entity)) continue;
-				if (mask == (mask & mEntities[entity])) {
-					found = true;
-					break;
-				}
-				entity++;
+			for (EntityID entity = 0; entity <= mMaxEntityID; entity++) {
+				if (IsEntity(entity) && mask == (mask & mEntities[entity])) return entity;
 			}
 
-			return found ? entity : AR_INVALID_ENTITY_ID;
+			return AR_INVALID_ENTITY_ID;
 		}
 
-		template<typename ..._Types>
-		EntityID FindEntity(const std::function<bool(_Types &...)> &condition) const {
-			const uint32_t componentCount = sizeof...(_Types);
-			const ComponentID componentIDs[] = { GetComponentID<_Types>()... };
-			std::bitset<AR_MAX_COMPONENTS> mask;
-			for (uint32_t i = 1; i < componentCount; i++) {
-				mask.set(componentIDs[i]);
-			}
-
-			bool found = false;
-			EntityID entity = 0;
+		// `condition` is called as condition(components...).
+		template<typename ..._Types, typename _Func>
+		EntityID FindEntity(_Func &&condition) {
+			const std::bitset<AR_MAX_COMPONENTS> mask = GetComponentMask<_Types...>();
 
-			while (entity <= mMaxEntityID) {
-				if (!IsEntity(entity)) continue;
-				if (mask == (mask & mEntities[entity]) && condition(entity, GetComponent<_Types>(entity)...)) {
-					found = true;
-					break;
-				}
-				entity++;
+			for (EntityID entity = 0; entity <= mMaxEntityID; entity++) {
+				if (!IsEntity(entity) || mask != (mask & mEntities[entity])) continue;
+				if (condition(GetComponent<_Types>(entity)...)) return entity;
 			}
 
-			return found ? entity : AR_INVALID_ENTITY_ID;
+			return AR_INVALID_ENTITY_ID;
 		}
 
 		template<typename _Type, typename ..._Args>
@@ -236,6 +213,14 @@ namespace Arcane {
 		inline uint32_t GetMaxEntityID() const { return mMaxEntityID; }
 		inline uint32_t GetEntityCount() const { return AR_MAX_ENTITIES - mAvailableEntities.count(); }
 
+	private:
+		template<typename ..._Types>
+		static std::bitset<AR_MAX_COMPONENTS> GetComponentMask() {
+			std::bitset<AR_MAX_COMPONENTS> mask;
+			(mask.set(GetComponentID<_Types>()), ...);
+			return mask;
+		}
+
 	private:
 		std::vector<ComponentPool> mPools;
 		std::array<std::bitset<AR_MAX_COMPONENTS>, AR_MAX_ENTITIES> mEntities;
@@ -3,6 +3,7 @@
 #include "Components/Tag.hpp"
 
 #include <Arcane/Graphics/PBR/Renderer.hpp>
+#include <Arcane/System/Arena.hpp>
 
 #include <iostream>
 
@@ -12,6 +13,10 @@ namespace Arcane {
 		Renderer::Init(GraphicsContext::GetCurrent());
 	}
 
+	void SceneRenderer::Init(TaskGraph &startup) {
+		Renderer::Init(GraphicsContext::GetCurrent(), startup);
+	}
+
 	void SceneRenderer::Draw() {		
 		Renderer::Begin(
 			SceneView<RenderCamera>()
@@ -27,7 +32,26 @@ namespace Arcane {
 			Renderer::AddLight(transform.GetDirection(), dirLight);
 		});
 
-		SceneView<Transform, Mesh, Material>().ForEach(Renderer::Submit);
+		// Gathered first so that the model matrices are built in one batch.
+		SceneView<Transform, Mesh, Material> drawables;
+		FrameArena &arena = GetFrameArena();
+		Transform *transforms = arena.AllocateArray<Transform>(drawables.GetCount());
+		const Mesh **meshes = arena.AllocateArray<const Mesh*>(drawables.GetCount());
+		const Material **materials = arena.AllocateArray<const Material*>(drawables.GetCount());
+
+		uint32_t count = 0;
+		drawables.ForEach([&](Transform &transform, Mesh &mesh, Material &material) {
+			transforms[count] = transform;
+			meshes[count] = &mesh;
+			materials[count] = &material;
+			count++;
+		});
+
+		Matrix4 *models = arena.AllocateArray<Matrix4>(count);
+		ComputeModelMatrices(transforms, models, count);
+		for (uint32_t i = 0; i < count; i++) {
+			Renderer::Submit(models[i], transforms[i].Position, *meshes[i], *materials[i]);
+		}
 
 		Renderer::End();
 	}
@@ -1,10 +1,13 @@
 #pragma once
 
+#include <Arcane/System/TaskGraph.hpp>
+
 namespace Arcane {
 
 	class SceneRenderer {
 	public:
 		static void Init();
+		static void Init(TaskGraph &startup);
 		static void Draw();
 		static void Shutdown();
 	};
@@ -3,7 +3,7 @@
 #include "Scene.hpp"
 #include "Entity.hpp"
 #include <iostream>
-#include <functional>
+#include <type_traits>
 
 namespace Arcane {
 
@@ -68,26 +68,25 @@ namespace Arcane {
 			}
 		}
 
-		inline void ForEach(const std::function<void(Entity e, _Types &...)> &func) {
+		// `func` is called as func(entity, components...) when it accepts
+		// an Entity first, and as func(components...) otherwise.
+		template<typename _Func>
+		inline void ForEach(_Func &&func) {
 			for (EntityID i = 0; i < mScene->GetMaxEntityID(); i++) {
 				if (!mScene->IsEntity(i)) continue;
 				if (mMask != (mMask & mScene->GetEntityComponentMask(i))) continue;
 				
-				Entity entity(i, *mScene);
-				func(entity, mScene->GetComponent<_Types>(i)...);
-			}
-		}
-
-		inline void ForEach(const std::function<void(_Types &...)> &func) {
-			for (EntityID i = 0; i < mScene->GetMaxEntityID(); i++) {
-				if (!mScene->IsEntity(i)) continue;
-				if (mMask != (mMask & mScene->GetEntityComponentMask(i))) continue;
-				
-				func(mScene->GetComponent<_Types>(i)...);
+				if constexpr (std::is_invocable_v<_Func, Entity &, _Types &...>) {
+					Entity entity(i, *mScene);
+					func(entity, mScene->GetComponent<_Types>(i)...);
+				} else {
+					func(mScene->GetComponent<_Types>(i)...);
+				}
 			}
 		}
 
-		inline Entity FindFirst(const std::function<bool(Entity e, _Types &...)> &condition) {
+		template<typename _Func>
+		inline Entity FindFirst(_Func &&condition) {
 			for (EntityID i = 0; i < mScene->GetMaxEntityID(); i++) {
 				if (!mScene->IsEntity(i)) continue;
 				if (mMask != (mMask & mScene->GetEntityComponentMask(i))) continue;
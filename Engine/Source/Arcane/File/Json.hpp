@@ -13,7 +13,7 @@ namespace Arcane {
 	typedef rapidjson::GenericArray<false, JsonValue> JsonArray;
 	typedef rapidjson::GenericArray<true, JsonValue> JsonCArray;
 
-	JsonDocument ParseJson(const char *json) {
+	inline JsonDocument ParseJson(const char *json) {
 		JsonDocument doc;
 		doc.Parse(json);
 
@@ -22,4 +22,14 @@ namespace Arcane {
 		return doc;
 	}
 
+	// For text that is not null-terminated, like a chunk of a mapped file.
+	inline JsonDocument ParseJson(const char *json, size_t length) {
+		JsonDocument doc;
+		doc.Parse(json, length);
+
+		AR_ASSERT(!doc.HasParseError(), "Could not parse json: {}\n", (uint32_t)doc.GetParseError());
+
+		return doc;
+	}
+
 }
\ No newline at end of file
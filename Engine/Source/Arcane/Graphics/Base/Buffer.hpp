@@ -37,7 +37,7 @@ namespace Arcane {
 		inline void Resize(size_t size) { GetNativeBuffer()->Resize(size); }
 		inline size_t GetSize() const { return GetNativeBuffer()->GetSize(); }
 
-		inline Ref<NativeBuffer> GetNativeBuffer() const {
+		inline const Ref<NativeBuffer> &GetNativeBuffer() const {
 			AR_ASSERT(mNativeBuffer, "Native buffer is invalid");
 			return mNativeBuffer;
 		}
@@ -32,7 +32,7 @@ namespace Arcane {
 		inline const ImageFormat *GetAttachments() const { return GetNativeFramebuffer()->GetAttachments(); }
 		inline uint32_t GetAttachmentCount() const { return GetNativeFramebuffer()->GetAttachmentCount(); }
 
-		inline Ref<NativeFramebuffer> GetNativeFramebuffer() const {
+		inline const Ref<NativeFramebuffer> &GetNativeFramebuffer() const {
 			AR_ASSERT(mNativeFramebuffer, "Native framebuffer is invalid");
 			return mNativeFramebuffer;
 		}
@@ -18,6 +18,8 @@ namespace Arcane {
 		~GraphicsContext() { }
 
 		inline void Present() { mNativeContext->Present(); }
+		inline void MakeCurrent() { mNativeContext->MakeCurrent(); }
+		inline void ReleaseCurrent() { mNativeContext->ReleaseCurrent(); }
 		
 		inline uint32_t GetVersionMajor() const { return GetNativeContext()->GetVersionMajor(); }
 		inline uint32_t GetVersionMinor() const { return GetNativeContext()->GetVersionMinor(); }
@@ -27,7 +29,7 @@ namespace Arcane {
 		inline const GraphicsLimits &GetGraphicsLimits() const { return GetNativeContext()->GetGraphicsLimits(); }
 		inline GraphicsAPI GetGraphicsAPI() const { return GetNativeContext()->GetGraphicsAPI(); }
 
-		inline Ref<NativeGraphicsContext> GetNativeContext() const {
+		inline const Ref<NativeGraphicsContext> &GetNativeContext() const {
 			AR_ASSERT(mNativeContext, "Native context is invalid");
 			return mNativeContext;
 		}
@@ -27,9 +27,9 @@ namespace Arcane {
 		inline Buffer GetVertexBuffer(uint32_t index) const { return GetNativeMesh()->GetVertexBuffer(index); }
 		inline Buffer GetIndexBuffer() const { return GetNativeMesh()->GetIndexBuffer(); }
 
-		inline InputLayout GetLayout() const { return GetNativeMesh()->GetLayout(); }
+		inline const InputLayout &GetLayout() const { return GetNativeMesh()->GetLayout(); }
 
-		inline Ref<NativeMesh> GetNativeMesh() const {
+		inline const Ref<NativeMesh> &GetNativeMesh() const {
 			AR_ASSERT(mNativeMesh, "Native mesh is invalid");
 			return mNativeMesh; 
 		}
@@ -20,7 +20,7 @@ namespace Arcane {
 		inline WindingOrder GetWindingOrder() const { return GetNativePipeline()->GetWindingOrder(); }
 		inline FillMode GetFillMode() const { return GetNativePipeline()->GetFillMode(); }
 		inline PrimitiveTopology GetTopology() const { return GetNativePipeline()->GetTopology(); }
-		inline InputLayout GetLayout() const { return GetNativePipeline()->GetLayout(); }
+		inline const InputLayout &GetLayout() const { return GetNativePipeline()->GetLayout(); }
 		inline Rect2D GetViewport() const { return GetNativePipeline()->GetViewport(); }
 		inline Rect2D GetScissor() const { return GetNativePipeline()->GetScissor(); }
 		inline size_t GetElementSize() const { return GetNativePipeline()->GetElementSize(); }
@@ -36,7 +36,7 @@ namespace Arcane {
 		inline void SetUniformBuffer(uint32_t index, const Buffer &buffer, size_t offset, size_t size) { GetNativePipeline()->SetUniformBuffer(index, buffer.GetNativeBuffer(), offset, size); }
 		inline void SetCombinedImageSampler(uint32_t index, const Texture &texture, const Sampler &sampler) { GetNativePipeline()->SetCombinedImageSampler(index, texture.GetNativeTexture(), sampler.GetNativeSampler()); }
 
-		inline Ref<NativePipeline> GetNativePipeline() const {
+		inline const Ref<NativePipeline> &GetNativePipeline() const {
 			AR_ASSERT(mNativePipeline, "Native pipeline is invalid");
 			return mNativePipeline;
 		}
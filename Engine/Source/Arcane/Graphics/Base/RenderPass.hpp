@@ -20,7 +20,7 @@ namespace Arcane {
 		inline const ImageFormat *GetAttachments() const { return GetNativeRenderPass()->GetAttachments(); }
 		inline uint32_t GetAttachmentCount() const { return GetNativeRenderPass()->GetAttachmentCount(); }
 
-		inline Ref<NativeRenderPass> GetNativeRenderPass() const {
+		inline const Ref<NativeRenderPass> &GetNativeRenderPass() const {
 			AR_ASSERT(mNativeRenderPass, "Native render pass is invalid");
 			return mNativeRenderPass;
 		}
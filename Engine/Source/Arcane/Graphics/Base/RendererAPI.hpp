@@ -38,9 +38,9 @@ namespace Arcane {
 		inline void DrawIndexed(uint32_t instances, uint32_t count) { GetNativeRendererAPI()->DrawIndexed(instances, count, 0, 0); }
 		inline void DrawIndexed(uint32_t instances, uint32_t count, size_t idxOffset, size_t vtxOffset) { GetNativeRendererAPI()->DrawIndexed(instances, count, 0, 0); }
 
-		inline FrameStatistics GetFrameStatistics() { return GetNativeRendererAPI()->GetFrameStatistics(); }
+		inline FrameStatistics GetFrameStatistics() const { return mNativeRendererAPI->GetFrameStatistics(); }
 
-		inline Ref<NativeRendererAPI> GetNativeRendererAPI() {
+		inline const Ref<NativeRendererAPI> &GetNativeRendererAPI() {
 			AR_ASSERT(mNativeRendererAPI, "Native renderer API is invalid");
 			return mNativeRendererAPI;
 		}
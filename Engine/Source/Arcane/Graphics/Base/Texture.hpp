@@ -28,7 +28,7 @@ namespace Arcane {
 		inline uint32_t GetSampleCount() const { return GetNativeTexture()->GetSampleCount(); }
 		inline bool HasFixedSampleLocations() const { return GetNativeTexture()->HasFixedSampleLocations(); }
 
-		inline Ref<NativeTexture> GetNativeTexture() const {
+		inline const Ref<NativeTexture> &GetNativeTexture() const {
 			AR_ASSERT(mNativeTexture, "Native texture is invalid");
 			return mNativeTexture;
 		}
@@ -56,7 +56,7 @@ namespace Arcane {
 		inline SamplerWrap GetWrapT() const { return GetNativeSampler()->GetWrapT(); }
 		inline SamplerWrap GetWrapR() const { return GetNativeSampler()->GetWrapR(); }
 
-		inline Ref<NativeSampler> GetNativeSampler() const {
+		inline const Ref<NativeSampler> &GetNativeSampler() const {
 			AR_ASSERT(mNativeSampler, "Native sampler is invalid");
 			return mNativeSampler;
 		}
@@ -1,6 +1,9 @@
 #include "Loader.hpp"
 
 #include <Arcane/Util/ByteUtil.hpp>
+#include <Arcane/System/Memory.hpp>
+#include <Arcane/System/AsyncFileIO.hpp>
+#include <Arcane/System/ThreadPool.hpp>
 
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb_image.h>
@@ -25,18 +28,24 @@ namespace Arcane {
 		return 0;
 	}
 
-	ImageData LoadImage(const std::string &path, ImageFormat requestedFormat) {
+	struct ImageLoad {
+		std::string Path;
+		ImageFormat RequestedFormat;
+		FileHandle File;
+		BufferRef Contents;
+		ImageLoadCallback Callback;
+		void *UserData;
+	};
+
+	static ImageData DecodeImage(const std::string &path, const void *contents, size_t size, ImageFormat requestedFormat) {
+		MemoryTagScope tag(MemoryTag::Assets);
+
 		int width = 0;
 		int height = 0;
 		int channels = 0;
 
 		const uint32_t requestedChannels = ImageFormatToChannels(requestedFormat);
-
-		FILE *f = fopen(path.c_str(), "rb");
-		AR_ASSERT(f, "Failed to open image: {}\n", path);
-
-		const stbi_uc *pixels = stbi_load_from_file(f, &width, &height, &channels, requestedChannels);
-		fclose(f);
+		const stbi_uc *pixels = stbi_load_from_memory((const stbi_uc*)contents, (int)size, &width, &height, &channels, requestedChannels);
 
 		AR_ASSERT(pixels, "Failed to load image: {}\n\t{}\n", path, stbi_failure_reason());
 
@@ -59,7 +68,69 @@ namespace Arcane {
 		return data;
 	}
 
+	// Runs on the thread pool, so decoding does not hold up other reads.
+	static void OnImageRead(const FileReadResult &result, void *userData) {
+		ImageLoad *load = (ImageLoad*)userData;
+		AsyncFileIO::Close(load->File);
+		AR_ASSERT(result.Success && result.Size == load->Contents.GetSize(), "Failed to read image: {}\n", load->Path);
+
+		ImageData image = DecodeImage(load->Path, load->Contents.GetPointer(), result.Size, load->RequestedFormat);
+		load->Contents = BufferRef();
+		load->Callback(image, load->UserData);
+		PoolDelete(load);
+	}
+
+	void LoadImageAsync(const std::string &path, ImageFormat requestedFormat, ImageLoadCallback callback, void *userData) {
+		size_t size = 0;
+		const FileHandle file = AsyncFileIO::Open(path, &size);
+
+		ImageLoad *load = PoolNew<ImageLoad>();
+		load->Path = path;
+		load->RequestedFormat = requestedFormat;
+		load->File = file;
+		load->Contents = AllocateBuffer(size);
+		load->Callback = callback;
+		load->UserData = userData;
+
+		FileReadRequest request{};
+		request.File = file;
+		request.Buffer = load->Contents.GetPointer();
+		request.Size = size;
+		request.Offset = 0;
+		request.Callback = OnImageRead;
+		request.UserData = load;
+		request.CallbackThread = FileReadCallbackThread::ThreadPool;
+		GetAsyncFileIO().Read(request);
+	}
+
+	struct PendingImage {
+		ImageData Image;
+		std::atomic<bool> Loaded;
+	};
+
+	static void OnImageLoaded(ImageData &image, void *userData) {
+		PendingImage *pending = (PendingImage*)userData;
+		pending->Image = image;
+		pending->Loaded.store(true, std::memory_order_release);
+	}
+
+	ImageData LoadImage(const std::string &path, ImageFormat requestedFormat) {
+		PendingImage pending{ {}, false };
+		LoadImageAsync(path, requestedFormat, OnImageLoaded, &pending);
+
+		// Like AsyncFileIO::Await(), other work keeps going meanwhile, which
+		// may include decoding this image.
+		ThreadPool *pool = HasThreadPool() ? &GetThreadPool() : nullptr;
+		while (!pending.Loaded.load(std::memory_order_acquire)) {
+			if (!(pool && pool->RunPendingTask())) Thread::Switch();
+		}
+
+		return pending.Image;
+	}
+
 	ImageData LoadImage(const Color &color, ImageFormat format) {
+		MemoryTagScope tag(MemoryTag::Assets);
+
 		ImageData output{};
 
 		if (format == ImageFormat::RGBA8) {
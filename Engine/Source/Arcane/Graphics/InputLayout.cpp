@@ -73,7 +73,7 @@ namespace Arcane {
 
 	void InputLayout::Append(const InputLayout &other) {
 		for (const InputElement &e : other.mElements) {
-			mElements.push_back(e);
+			mElements.Push(e);
 			mTotalSize += GetInputElementSize(e);
 		}
 	}
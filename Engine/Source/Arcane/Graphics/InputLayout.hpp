@@ -1,8 +1,10 @@
 #pragma once
 
 #include <Arcane/Core.hpp>
+#include <Arcane/Data/SmallVector.hpp>
 #include <initializer_list>
-#include <vector>
+
+#define AR_INPUT_LAYOUT_INLINE_ELEMENTS 8
 
 namespace Arcane {
 
@@ -41,10 +43,10 @@ namespace Arcane {
 	class InputLayout {
 	public:
 		InputLayout(const std::initializer_list<InputElement> &elements);
-		InputLayout() { }
+		InputLayout() : mTotalSize(0) { }
 		~InputLayout() { }
 
-		inline std::vector<InputElement> GetElements() const { return mElements; }
+		inline const SmallVector<InputElement, AR_INPUT_LAYOUT_INLINE_ELEMENTS> &GetElements() const { return mElements; }
 		inline size_t GetTotalSize() const { return mTotalSize; }
 
 		void Append(const InputLayout &other);
@@ -54,7 +56,7 @@ namespace Arcane {
 
 	private:
 		size_t mTotalSize;
-		std::vector<InputElement> mElements;
+		SmallVector<InputElement, AR_INPUT_LAYOUT_INLINE_ELEMENTS> mElements;
 	};
 
-}
+}
\ No newline at end of file
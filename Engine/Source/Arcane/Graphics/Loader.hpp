@@ -18,6 +18,13 @@ namespace Arcane {
 		Invert,
 	};
 
+	// Called on a thread pool worker once the image has been decoded.
+	typedef void(*ImageLoadCallback)(ImageData &image, void *userData);
+
+	// Reads the file through the async file IO service and decodes it on the
+	// thread pool once the read completes, without blocking the caller.
+	void LoadImageAsync(const std::string &path, ImageFormat requestedFormat, ImageLoadCallback callback, void *userData);
+	// LoadImageAsync(), running thread pool tasks until the image is ready.
 	ImageData LoadImage(const std::string &path, ImageFormat requestedFormat);
 	ImageData LoadImage(const Color &color, ImageFormat format);
 	
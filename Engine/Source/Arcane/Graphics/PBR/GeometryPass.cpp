@@ -2,18 +2,7 @@
 
 namespace Arcane {
 
-	GeometryPass::GeometryPass(const GraphicsContext &context, const RendererAPI &rendererApi, const Buffer &cameraData, const Buffer &objectData, const Buffer &shadowData, const Sampler &sampler) : mContext(context), mRendererAPI(rendererApi), mObjectBuffer(objectData), mSampler(sampler) {
-		CompileShader(
-			mContext, 
-			"Engine/Shaders/Geometry/Source/GeometryShader.vert", 
-			"Engine/Shaders/Geometry/Binaries/Output/GeometryShader.vert.spv"
-		);
-		CompileShader(
-			mContext,
-			"Engine/Shaders/Geometry/Source/GeometryShader.frag",
-			"Engine/Shaders/Geometry/Binaries/Output/GeometryShader.frag.spv"
-		);
-		
+	GeometryPass::GeometryPass(const GraphicsContext &context, const RendererAPI &rendererApi, const Buffer &cameraData, const Buffer &objectData, const Buffer &shadowData, const Sampler &sampler, const ShaderProgram &shaders) : mContext(context), mRendererAPI(rendererApi), mObjectBuffer(objectData), mSampler(sampler) {
 		const ImageFormat geometryAttachments[] = {
 			ImageFormat::RGB32F,
 			ImageFormat::RGBA8U,
@@ -53,16 +42,13 @@ namespace Arcane {
 			{ InputAttribute::Bitangent, 1, InputElementType::Vector3f32, false },
 		};
 		
-		BufferRef vertexShaderBinary = ReadFileBinary("Engine/Shaders/Geometry/Binaries/Output/GeometryShader.vert.spv");
-		BufferRef fragmentShaderBinary = ReadFileBinary("Engine/Shaders/Geometry/Binaries/Output/GeometryShader.frag.spv");
-		
 		PipelineInfo geometryPipelineInfo = PipelineInfo::CreateWithDefaultInfo();
 		geometryPipelineInfo.CullMode = CullMode::None;
 		geometryPipelineInfo.Descriptors = geometryDescriptors;
 		geometryPipelineInfo.DescriptorCount = 8;
 		geometryPipelineInfo.Layout = geometryInputLayout;
-		geometryPipelineInfo.VertexShaderBinary = vertexShaderBinary;
-		geometryPipelineInfo.FragmentShaderBinary = fragmentShaderBinary;
+		geometryPipelineInfo.VertexShaderBinary = shaders.Vertex.Binary;
+		geometryPipelineInfo.FragmentShaderBinary = shaders.Fragment.Binary;
 		geometryPipelineInfo.SampleCount = 1;
 
 		mPipeline = Pipeline::Create(mContext, geometryPipelineInfo);
@@ -75,7 +61,7 @@ namespace Arcane {
 
 	GeometryPass::~GeometryPass() { }
 
-	void GeometryPass::Execute(const Camera &camera, const std::vector<RenderSubmission> &submissions) {
+	void GeometryPass::Execute(const Camera &camera, const RenderSubmissionList &submissions) {
 		mFramebuffer.Resize(mContext.GetWindow().GetClientSize());
 
 		mRendererAPI.BeginRenderPass(mRenderPass, mFramebuffer);
@@ -83,12 +69,11 @@ namespace Arcane {
 
 		ObjectData objectData;
 
-		const Matrix4 projection = camera.GetProjectionMatrix();
-		const Matrix4 view = camera.GetViewMatrix();
+		const Matrix4 viewProjection = camera.GetProjectionMatrix() * camera.GetViewMatrix();
 
 		for (const RenderSubmission &submission : submissions) {
 			objectData.Model = Matrix4::Transpose(submission.Model);
-			objectData.MVP = Matrix4::Transpose(projection * view * objectData.Model);
+			objectData.MVP = Matrix4::Transpose(viewProjection * objectData.Model);
 			objectData.Position = Vector4(submission.Position, 1.0);
 
 			mObjectBuffer.SetData(objectData);
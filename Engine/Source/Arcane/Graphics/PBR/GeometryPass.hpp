@@ -16,10 +16,10 @@ namespace Arcane {
 	class GeometryPass {
 	public:
 		GeometryPass() = default;
-		GeometryPass(const GraphicsContext &context, const RendererAPI &rendererApi, const Buffer &cameraData, const Buffer &objectData, const Buffer &shadowData, const Sampler &sampler);
+		GeometryPass(const GraphicsContext &context, const RendererAPI &rendererApi, const Buffer &cameraData, const Buffer &objectData, const Buffer &shadowData, const Sampler &sampler, const ShaderProgram &shaders);
   		~GeometryPass();
 
-		void Execute(const Camera &camera, const std::vector<RenderSubmission> &submissions);
+		void Execute(const Camera &camera, const RenderSubmissionList &submissions);
 
 		inline Framebuffer &GetFramebuffer() { return mFramebuffer; }
 		inline RenderPass &GetRenderPass() { return mRenderPass; }
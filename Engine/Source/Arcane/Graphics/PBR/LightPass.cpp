@@ -4,17 +4,7 @@
 
 namespace Arcane {
 
-	LightPass::LightPass(const GraphicsContext &context, const RendererAPI &rendererApi, const Buffer &cameraData, const Buffer &lightData, const Sampler &sampler, const Sampler &shadowSampler) : mContext(context), mRendererAPI(rendererApi), mSampler(sampler), mShadowSampler(shadowSampler) {		
-		CompileShader(mContext,
-			"Engine/Shaders/Light/Source/LightShader.vert",
-			"Engine/Shaders/Light/Binaries/Output/LightShader.vert.spv"
-		);
-
-		CompileShader(mContext,
-			"Engine/Shaders/Light/Source/LightShader.frag",
-			"Engine/Shaders/Light/Binaries/Output/LightShader.frag.spv"
-		);
-
+	LightPass::LightPass(const GraphicsContext &context, const RendererAPI &rendererApi, const Buffer &cameraData, const Buffer &lightData, const Sampler &sampler, const Sampler &shadowSampler, const ShaderProgram &shaders) : mContext(context), mRendererAPI(rendererApi), mSampler(sampler), mShadowSampler(shadowSampler) {		
 		const ImageFormat lightAttachments[] = {
 			ImageFormat::RGB8,
 			ImageFormat::D24S8
@@ -47,15 +37,12 @@ namespace Arcane {
 			{ InputAttribute::UV, 1, InputElementType::Vector2f32, false },	
 		};
 
-		BufferRef vertexShaderBinary = ReadFileBinary("Engine/Shaders/Light/Binaries/Output/LightShader.vert.spv");
-		BufferRef fragmentShaderBinary = ReadFileBinary("Engine/Shaders/Light/Binaries/Output/LightShader.frag.spv");
-
 		PipelineInfo lightPipelineInfo = PipelineInfo::CreateWithDefaultInfo();
 		lightPipelineInfo.Descriptors = lightDescriptors;
 		lightPipelineInfo.DescriptorCount = 8;
 		lightPipelineInfo.Layout = lightInputLayout;
-		lightPipelineInfo.VertexShaderBinary = vertexShaderBinary;
-		lightPipelineInfo.FragmentShaderBinary = fragmentShaderBinary;
+		lightPipelineInfo.VertexShaderBinary = shaders.Vertex.Binary;
+		lightPipelineInfo.FragmentShaderBinary = shaders.Fragment.Binary;
 		lightPipelineInfo.SampleCount = AR_SAMPLE_COUNT;
 
 		mPipeline = Pipeline::Create(mContext, lightPipelineInfo);
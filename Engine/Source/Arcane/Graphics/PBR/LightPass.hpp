@@ -16,7 +16,7 @@ namespace Arcane {
 	class LightPass {
 	public:
 		LightPass() = default;
-		LightPass(const GraphicsContext &context, const RendererAPI &rendererApi, const Buffer &cameraData, const Buffer &lightData, const Sampler &sampler, const Sampler &shadowSampler);
+		LightPass(const GraphicsContext &context, const RendererAPI &rendererApi, const Buffer &cameraData, const Buffer &lightData, const Sampler &sampler, const Sampler &shadowSampler, const ShaderProgram &shaders);
 		
 		void Execute(const Camera &camera, const Mesh &quadMesh, const Framebuffer &geometryFramebuffer, const Framebuffer &shadowFramebuffer);
 
@@ -10,6 +10,7 @@
 #include <Arcane/Data/BufferData.hpp>
 #include <Arcane/Graphics/Shader.hpp>
 #include <Arcane/Util/FileUtil.hpp>
+#include <Arcane/System/Arena.hpp>
 
 #define AR_SHADOW_MAP_WIDTH 1024
 #define AR_SHADOW_MAP_HEIGHT 1024
@@ -42,6 +43,9 @@ namespace Arcane {
 		Texture AmbientOcclusionMap;
 	};
 
+	// Submissions live in the frame arena of the frame that recorded them.
+	typedef FrameVector<RenderSubmission> RenderSubmissionList;
+
 	struct LightData {
 		struct {
 			Vector4 Position;
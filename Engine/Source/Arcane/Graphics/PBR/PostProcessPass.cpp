@@ -2,18 +2,7 @@
 
 namespace Arcane {
 
-	PostProcessPass::PostProcessPass(const GraphicsContext &context, const RendererAPI &rendererApi, const Buffer &postProcessSettings, const Sampler &sampler) : mContext(context), mRendererAPI(rendererApi), mSampler(sampler) {
-		CompileShader(
-			mContext,
-			"Engine/Shaders/PostProcess/Source/PostProcessShader.vert",
-			"Engine/Shaders/PostProcess/Binaries/Output/PostProcessShader.vert.spv"
-		);
-		CompileShader(
-			mContext,
-			"Engine/Shaders/PostProcess/Source/PostProcessShader.frag",
-			"Engine/Shaders/PostProcess/Binaries/Output/PostProcessShader.frag.spv"
-		);
-
+	PostProcessPass::PostProcessPass(const GraphicsContext &context, const RendererAPI &rendererApi, const Buffer &postProcessSettings, const Sampler &sampler, const ShaderProgram &shaders) : mContext(context), mRendererAPI(rendererApi), mSampler(sampler) {
 		const ImageFormat postProcessAttachments[] = {
 			ImageFormat::RGB8,
 			ImageFormat::D24S8
@@ -39,15 +28,12 @@ namespace Arcane {
 			{ InputAttribute::UV, 1, InputElementType::Vector2f32, false },
 		};
 
-		BufferRef vertexShaderBinary = ReadFileBinary("Engine/Shaders/PostProcess/Binaries/Output/PostProcessShader.vert.spv");
-		BufferRef fragmentShaderBinary = ReadFileBinary("Engine/Shaders/PostProcess/Binaries/Output/PostProcessShader.frag.spv");
-
 		PipelineInfo postProcessPipelineInfo = PipelineInfo::CreateWithDefaultInfo();
 		postProcessPipelineInfo.Descriptors = postProcessDescriptors;
 		postProcessPipelineInfo.DescriptorCount = 2;
 		postProcessPipelineInfo.Layout = postProcessInputLayout;
-		postProcessPipelineInfo.VertexShaderBinary = vertexShaderBinary;
-		postProcessPipelineInfo.FragmentShaderBinary = fragmentShaderBinary;
+		postProcessPipelineInfo.VertexShaderBinary = shaders.Vertex.Binary;
+		postProcessPipelineInfo.FragmentShaderBinary = shaders.Fragment.Binary;
 		postProcessPipelineInfo.SampleCount = AR_SAMPLE_COUNT;
 
 		mPipeline = Pipeline::Create(mContext, postProcessPipelineInfo);
@@ -16,7 +16,7 @@ namespace Arcane {
 	class PostProcessPass {
 	public:
 		PostProcessPass() = default;
-		PostProcessPass(const GraphicsContext &context, const RendererAPI &rendererApi, const Buffer &postProcessSettings, const Sampler &sampler);
+		PostProcessPass(const GraphicsContext &context, const RendererAPI &rendererApi, const Buffer &postProcessSettings, const Sampler &sampler, const ShaderProgram &shaders);
 		
 		void Execute(const Camera &camera, const Mesh &quadMesh, const Framebuffer &lightFramebuffer);
 
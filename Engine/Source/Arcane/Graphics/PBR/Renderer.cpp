@@ -6,6 +6,12 @@
 #include <Arcane/Graphics/Base/Pipeline.hpp>
 #include <Arcane/Util/FileUtil.hpp>
 #include <Arcane/System/Time.hpp>
+#include <Arcane/System/Thread.hpp>
+#include <Arcane/System/CPU.hpp>
+#include <Arcane/System/TaskGraph.hpp>
+#include <Arcane/System/Memory.hpp>
+#include <Arcane/System/FileWatcher.hpp>
+#include <Arcane/Data/Queue.hpp>
 #include "PBRCommon.hpp"
 
 #include "GeometryPass.hpp"
@@ -15,12 +21,42 @@
 
 namespace Arcane {
 
-	static CameraData sCameraData;
-	static PostProcessSettings sPostProcessSettings;
-	static LightData sLightData;
-	static ShadowPassData sShadowPassData;
-
-	static Camera3D sCamera;
+	// Everything recorded between Begin() and End(). In pipelined mode the
+	// main thread records one packet while the render thread executes older
+	// ones.
+	struct FramePacket {
+		CameraData CameraData;
+		PostProcessSettings PostProcessSettings;
+		LightData LightData;
+		ShadowPassData ShadowPassData;
+		bool HasShadowPassData;
+		Camera3D Camera;
+		Color ClearColor;
+		RenderSubmissionList Submissions;
+		// Written by whichever thread executed the packet, once it is done.
+		FrameStatistics Statistics;
+	};
+
+	// A packet is read by the render thread up to AR_MAX_FRAMES_IN_FLIGHT
+	// frames after it was recorded, so its frame arena must not be reset
+	// before then.
+	static_assert(AR_MAX_FRAMES_IN_FLIGHT + 1 <= AR_FRAME_ARENA_COUNT, "Frame arenas are reused while frames are still in flight");
+
+	static FramePacket sFramePackets[AR_MAX_FRAMES_IN_FLIGHT + 1];
+	static FramePacket *sRecording = &sFramePackets[0];
+	static uint32_t sRecordingIndex = 0;
+	static size_t sLastSubmissionCount = 0;
+	// Only touched by the thread that calls End().
+	static FrameStatistics sFrameStatistics;
+
+	static bool sPipelined = false;
+	static uint32_t sFramesInFlight = 0;
+	static Thread sRenderThread;
+	static SPSCQueue<FramePacket*> sRenderQueue(AR_MAX_FRAMES_IN_FLIGHT + 2);
+	static Semaphore sFramesReady;
+	static Semaphore sFreePackets;
+	// One bit per render pass whose shaders have to be rebuilt.
+	static std::atomic<uint32_t> sReloadMask = 0;
 
 	static GraphicsContext sContext;
 
@@ -36,13 +72,9 @@ namespace Arcane {
 	static LightPass sLightPass;
 	static PostProcessPass sPostProcessPass;
 
-	static Color sClearColor;
-	
 	static Mesh sQuadMesh;
 	static Sampler sDefaultSampler, sShadowSampler;
 
-	static std::vector<RenderSubmission> sRenderSubmissions;
-
 	static void InitBuffers() {
 		sCameraBuffer = Buffer::Create(sContext, sizeof(CameraData), BufferFlag::Static);
 		sObjectBuffer = Buffer::Create(sContext, sizeof(ObjectData));
@@ -107,80 +139,174 @@ namespace Arcane {
 		sQuadMesh.SetIndexBuffer(quadIndexBuffer);
 	}
 
-	static void InitPostProcessPass() {
-	}
+	enum RenderPassIndex {
+		RenderPass_Geometry = 0, RenderPass_Shadow, RenderPass_Light, RenderPass_PostProcess, RenderPass_Count
+	};
 
-	void Renderer::Init(const GraphicsContext &context) {
-		AR_PROFILE_FUNCTION();
-		sContext = context;
+	static const char *sPassNames[RenderPass_Count] = { "Geometry", "Shadow", "Light", "PostProcess" };
+	static ShaderProgram sPassShaders[RenderPass_Count];
+	static FileWatchID sShaderWatches[RenderPass_Count * 2];
+
+	static constexpr uint32_t AllPasses = (1 << RenderPass_Count) - 1;
 
+	static void *InitResources(void *data) {
+		AR_PROFILE_FUNCTION();
 		sRendererAPI = RendererAPI::Create(sContext);
 
 		InitBuffers();
 		InitSamplers();
 		InitFullscreenQuad();
+		return nullptr;
+	}
+
+	static void *CreatePass(void *data) {
+		const RenderPassIndex pass = (RenderPassIndex)(uintptr_t)data;
+		const ShaderProgram &shaders = sPassShaders[pass];
+
+		switch (pass) {
+			case RenderPass_Geometry: sGeometryPass = GeometryPass(sContext, sRendererAPI, sCameraBuffer, sObjectBuffer, sShadowBuffer, sDefaultSampler, shaders); break;
+			case RenderPass_Shadow: sShadowPass = ShadowPass(sContext, sRendererAPI, sObjectBuffer, sShadowBuffer, shaders); break;
+			case RenderPass_Light: sLightPass = LightPass(sContext, sRendererAPI, sCameraBuffer, sLightBuffer, sDefaultSampler, sShadowSampler, shaders); break;
+			case RenderPass_PostProcess: sPostProcessPass = PostProcessPass(sContext, sRendererAPI, sPostProcessSettingsBuffer, sDefaultSampler, shaders); break;
+			default: AR_ASSERT(false, "Unknown render pass {}", (uint32_t)pass);
+		}
+
+		// The pipelines keep what they need; the SPIR-V is not needed again.
+		sPassShaders[pass].Vertex.Binary = BufferRef();
+		sPassShaders[pass].Fragment.Binary = BufferRef();
+		return nullptr;
+	}
+
+	// Shader compilation and reads run on the thread pool; only the pass
+	// objects themselves are created on the context thread, once their
+	// shaders and the shared resources exist.
+	static void AddPassTasks(TaskGraph &graph, TaskGraphNodeID resources = UINT32_MAX, uint32_t passes = AllPasses) {
+		for (uint32_t i = 0; i < RenderPass_Count; i++) {
+			if (!(passes & AR_BIT(i))) continue;
+
+			sPassShaders[i] = GetEngineShaderProgram(sContext, sPassNames[i]);
+
+			const TaskGraphNodeID vertex = graph.AddTask(std::string("Compile ") + sPassNames[i] + "Shader.vert", CompileShaderTask, &sPassShaders[i].Vertex);
+			const TaskGraphNodeID fragment = graph.AddTask(std::string("Compile ") + sPassNames[i] + "Shader.frag", CompileShaderTask, &sPassShaders[i].Fragment);
 
-		Reload();
+			const TaskGraphNodeID create = graph.AddContextTask(std::string("Create ") + sPassNames[i] + "Pass", CreatePass, (void*)(uintptr_t)i, { vertex, fragment });
+			if (resources != UINT32_MAX) graph.AddDependency(create, resources);
+		}
+	}
+
+	// Runs on the file watcher thread, so the pass is only marked here and
+	// rebuilt by whichever thread owns the context.
+	static void OnShaderChanged(const std::filesystem::path &path, void *userData) {
+		sReloadMask.fetch_or(AR_BIT((uint32_t)(uintptr_t)userData), std::memory_order_relaxed);
+	}
+
+	void Renderer::Init(const GraphicsContext &context) {
+		TaskGraph graph;
+		Init(context, graph);
+		graph.Execute(GetThreadPool());
+		graph.LogTimings("Renderer initialization");
+	}
+
+	void Renderer::Init(const GraphicsContext &context, TaskGraph &graph) {
+		AR_PROFILE_FUNCTION();
+		sContext = context;
+
+		const TaskGraphNodeID resources = graph.AddContextTask("Create renderer resources", InitResources, nullptr);
+		AddPassTasks(graph, resources);
+
+		// Editing a shader source rebuilds only the pass that uses it.
+		if (HasFileWatcher()) {
+			for (uint32_t i = 0; i < RenderPass_Count; i++) {
+				const ShaderProgram program = GetEngineShaderProgram(context, sPassNames[i]);
+				sShaderWatches[i * 2] = GetFileWatcher().Watch(program.Vertex.Source, OnShaderChanged, (void*)(uintptr_t)i);
+				sShaderWatches[i * 2 + 1] = GetFileWatcher().Watch(program.Fragment.Source, OnShaderChanged, (void*)(uintptr_t)i);
+			}
+		}
 	}
 
 	void Renderer::Shutdown() {
 		AR_PROFILE_FUNCTION();
+		SetPipelined(false);
+
+		if (HasFileWatcher() && sShaderWatches[0] != 0) {
+			for (FileWatchID &watch : sShaderWatches) {
+				GetFileWatcher().Unwatch(watch);
+				watch = 0;
+			}
+		}
 	}
 
-	void Renderer::Reload() {
+	static void ReloadPasses(uint32_t passes) {
 		AR_PROFILE_FUNCTION();
+		UncheckedAllocationScope unchecked;
+
+		TaskGraph graph;
+		AddPassTasks(graph, UINT32_MAX, passes);
+		graph.Execute(GetThreadPool());
+		graph.LogTimings("Renderer reload");
+	}
+
+	void Renderer::Reload() {
+		if (sPipelined) {
+			sReloadMask.fetch_or(AllPasses, std::memory_order_relaxed);
+			return;
+		}
 
-		sGeometryPass = GeometryPass(sContext, sRendererAPI, sCameraBuffer, sObjectBuffer, sShadowBuffer, sDefaultSampler);
-		sShadowPass = ShadowPass(sContext, sRendererAPI, sObjectBuffer, sShadowBuffer);
-		sLightPass = LightPass(sContext, sRendererAPI, sCameraBuffer, sLightBuffer, sDefaultSampler, sShadowSampler);
-		sPostProcessPass = PostProcessPass(sContext, sRendererAPI, sPostProcessSettingsBuffer, sDefaultSampler);
+		ReloadPasses(AllPasses);
 	}
 
 	void Renderer::Begin(const RenderCamera &camera) {
 		AR_PROFILE_FUNCTION();
 
-		sCamera = camera.GetCamera();
+		FramePacket &packet = *sRecording;
+		packet.Camera = camera.GetCamera();
+		packet.Submissions.reserve(sLastSubmissionCount);
 
-		sCameraData.Projection = Matrix4::Transpose(camera.GetCamera().GetProjectionMatrix());
-		sCameraData.View = Matrix4::Transpose(camera.GetCamera().GetViewMatrix());
-		sCameraData.Position = Vector4(camera.GetCamera().Position, 1.0);
-		sCameraData.NearPlane = camera.GetCamera().Near;
-		sCameraData.FarPlane = camera.GetCamera().Far;
+		packet.CameraData.Projection = Matrix4::Transpose(camera.GetCamera().GetProjectionMatrix());
+		packet.CameraData.View = Matrix4::Transpose(camera.GetCamera().GetViewMatrix());
+		packet.CameraData.Position = Vector4(camera.GetCamera().Position, 1.0);
+		packet.CameraData.NearPlane = camera.GetCamera().Near;
+		packet.CameraData.FarPlane = camera.GetCamera().Far;
 
-		sPostProcessSettings.Exposure = camera.GetExposure();
-		sPostProcessSettings.Gamma = camera.GetGamma();
+		packet.PostProcessSettings.Exposure = camera.GetExposure();
+		packet.PostProcessSettings.Gamma = camera.GetGamma();
 
-		sClearColor = camera.GetBackgroundColor();
+		packet.ClearColor = camera.GetBackgroundColor();
 	}
 
 	void Renderer::AddLight(const Vector3 &position, const PointLight &light) {
 		AR_PROFILE_FUNCTION();
-		uint32_t index = sLightData.PointLightCount++;
-		sLightData.PointLights[index].Color = light.Color;
-		sLightData.PointLights[index].Intensity = light.Intensity;
-		sLightData.PointLights[index].Position = Vector4(position, 1.0);
+		LightData &lightData = sRecording->LightData;
+		uint32_t index = lightData.PointLightCount++;
+		lightData.PointLights[index].Color = light.Color;
+		lightData.PointLights[index].Intensity = light.Intensity;
+		lightData.PointLights[index].Position = Vector4(position, 1.0);
 	}
 
 	void Renderer::AddLight(const Vector3 &direction, const DirectionalLight &light) {
 		AR_PROFILE_FUNCTION();
-		sLightData.DirectionalLight.Color = light.Color;
-		sLightData.DirectionalLight.Direction = Vector4(Vector3::Normalize(direction), 1.0);
+		FramePacket &packet = *sRecording;
+		packet.LightData.DirectionalLight.Color = light.Color;
+		packet.LightData.DirectionalLight.Direction = Vector4(Vector3::Normalize(direction), 1.0);
 
-		sShadowPassData.LightProjection = Matrix4::Transpose(
+		packet.ShadowPassData.LightProjection = Matrix4::Transpose(
 			Matrix4::OrthoLH_ZO(-10.0f, 10.0f, -10.0f, 10.0f, 0.0f, 30.0f)
 		);
-		sShadowPassData.LightView = Matrix4::Transpose(
+		packet.ShadowPassData.LightView = Matrix4::Transpose(
 			Matrix4::LookAtLH(Vector3::Normalize(-direction) * 5.0f, Vector3::Normalize(direction), Vector3(0.0f, 1.0f, 0.0f))	
 		);
-
-		sShadowBuffer.SetData(sShadowPassData);
+		packet.HasShadowPassData = true;
 	}
 
 	void Renderer::Submit(const Transform &transform, const Mesh &mesh, const Material &material) {
+		Submit(transform.GetModelMatrix(), transform.Position, mesh, material);
+	}
+
+	void Renderer::Submit(const Matrix4 &model, const Vector3 &position, const Mesh &mesh, const Material &material) {
 		AR_PROFILE_FUNCTION();
-		sRenderSubmissions.emplace_back(
-			transform.GetModelMatrix(),
-			transform.Position,
+		sRecording->Submissions.emplace_back(
+			model,
+			position,
 			mesh,
 			material.AlbedoMap,
 			material.NormalMap,
@@ -190,38 +316,156 @@ namespace Arcane {
 		);
 	}
 
-	void Renderer::End() {
+	static void ExecuteFrame(FramePacket &packet) {
 		AR_PROFILE_FUNCTION();
 
 		sRendererAPI.SetViewport(sContext.GetWindow().GetClientSize());
 		sRendererAPI.SetScissor(sContext.GetWindow().GetClientSize());
 		
-		sCameraBuffer.SetData(sCameraData);
-		sLightBuffer.SetData(sLightData);
-		sPostProcessSettingsBuffer.SetData(sPostProcessSettings);
+		sCameraBuffer.SetData(packet.CameraData);
+		sLightBuffer.SetData(packet.LightData);
+		sPostProcessSettingsBuffer.SetData(packet.PostProcessSettings);
+		if (packet.HasShadowPassData) sShadowBuffer.SetData(packet.ShadowPassData);
 		
 		sRendererAPI.Begin();
 
-		sRendererAPI.SetClearColor(sClearColor);
+		sRendererAPI.SetClearColor(packet.ClearColor);
 
-		sGeometryPass.Execute(sCamera, sRenderSubmissions);
-		sShadowPass.Execute(sCamera, sRenderSubmissions);
-		sLightPass.Execute(sCamera, sQuadMesh, sGeometryPass.GetFramebuffer(), sShadowPass.GetFramebuffer());
-		sPostProcessPass.Execute(sCamera, sQuadMesh, sLightPass.GetFramebuffer());
+		sGeometryPass.Execute(packet.Camera, packet.Submissions);
+		sShadowPass.Execute(packet.Camera, packet.Submissions);
+		sLightPass.Execute(packet.Camera, sQuadMesh, sGeometryPass.GetFramebuffer(), sShadowPass.GetFramebuffer());
+		sPostProcessPass.Execute(packet.Camera, sQuadMesh, sLightPass.GetFramebuffer());
 
 		sRendererAPI.End();
-		
-		sRenderSubmissions.clear();
+		packet.Statistics = sRendererAPI.GetFrameStatistics();
+	}
+
+	static void ClearFrame(FramePacket &packet) {
+		// Reassigned instead of cleared: the old storage belongs to a frame
+		// arena that is about to be reset.
+		packet.Submissions = RenderSubmissionList();
+		packet.HasShadowPassData = false;
+
+		std::memset(&packet.LightData, 0, sizeof(LightData));
+		std::memset(&packet.CameraData, 0, sizeof(CameraData));
+		std::memset(&packet.ShadowPassData, 0, sizeof(ShadowPassData));
+		std::memset(&packet.PostProcessSettings, 0, sizeof(PostProcessSettings));
+	}
+
+	static int32_t RenderThreadMain(void *data) {
+		AR_PROFILE_THREAD_NAME("Render Thread");
+		sContext.MakeCurrent();
+
+		while (true) {
+			sFramesReady.Wait();
+
+			FramePacket *packet;
+			[[maybe_unused]] const bool popped = sRenderQueue.Pop(packet);
+			AR_ASSERT(popped, "Render thread woke up without a frame");
+			if (packet == nullptr) break;
+
+			const uint32_t reload = sReloadMask.exchange(0, std::memory_order_relaxed);
+			if (reload != 0) ReloadPasses(reload);
 
-		std::memset(&sLightData, 0, sizeof(LightData));
-		std::memset(&sCameraData, 0, sizeof(CameraData));
-		std::memset(&sShadowPassData, 0, sizeof(ShadowPassData));
-		std::memset(&sPostProcessSettings, 0, sizeof(PostProcessSettings));
+			ExecuteFrame(*packet);
+			sContext.Present();
+			sFreePackets.Post();
+		}
+
+		sContext.ReleaseCurrent();
+		return 0;
+	}
+
+	void Renderer::End() {
+		AR_PROFILE_FUNCTION();
+		sLastSubmissionCount = sRecording->Submissions.size();
+
+		if (!sPipelined) {
+			const uint32_t reload = sReloadMask.exchange(0, std::memory_order_relaxed);
+			if (reload != 0) ReloadPasses(reload);
+
+			ExecuteFrame(*sRecording);
+			sFrameStatistics = sRecording->Statistics;
+			ClearFrame(*sRecording);
+			return;
+		}
+
+		sRenderQueue.Push(sRecording);
+		sFramesReady.Post();
+
+		// Blocks once the render thread is sFramesInFlight frames behind.
+		// Packets finish in order, so the oldest one is the one released.
+		{
+			AR_PROFILE_SCOPE("Renderer::WaitForFrame");
+			sFreePackets.Wait();
+		}
+
+		sRecordingIndex = (sRecordingIndex + 1) % (sFramesInFlight + 1);
+		sRecording = &sFramePackets[sRecordingIndex];
+		// The packet just released is the oldest one, so its statistics are
+		// the newest ones the render thread has finished.
+		sFrameStatistics = sRecording->Statistics;
+		ClearFrame(*sRecording);
+	}
+
+	void Renderer::Present() {
+		// In pipelined mode the render thread presents each frame after
+		// executing it.
+		if (!sPipelined) sContext.Present();
 	}
 
-	RendererAPI Renderer::GetRenderer() {
+	void Renderer::SetPipelined(bool pipelined, uint32_t framesInFlight) {
+		AR_PROFILE_FUNCTION();
+		if (pipelined == sPipelined) return;
+
+		if (pipelined) {
+			sFramesInFlight = Clamp<uint32_t>(framesInFlight, 1, AR_MAX_FRAMES_IN_FLIGHT);
+			sFramesReady = Semaphore::Create(0);
+			sFreePackets = Semaphore::Create(sFramesInFlight);
+
+			// The packet being recorded keeps its contents and becomes the
+			// first one of the ring.
+			if (sRecording != &sFramePackets[0]) std::swap(sFramePackets[0], *sRecording);
+			sRecordingIndex = 0;
+			sRecording = &sFramePackets[0];
+
+			sContext.ReleaseCurrent();
+			sPipelined = true;
+
+			sRenderThread = Thread::Create(RenderThreadMain, nullptr);
+			PinToReservedCore(sRenderThread, CoreRole::Render);
+			sRenderThread.Start();
+			return;
+		}
+
+		// Everything queued before the sentinel is still rendered.
+		sRenderQueue.Push(nullptr);
+		sFramesReady.Post();
+		Thread::Await(sRenderThread);
+		sRenderThread = Thread();
+
+		sPipelined = false;
+		sContext.MakeCurrent();
+
+		for (FramePacket &packet : sFramePackets) {
+			if (&packet != sRecording) ClearFrame(packet);
+		}
+
+		const uint32_t reload = sReloadMask.exchange(0, std::memory_order_relaxed);
+		if (reload != 0) ReloadPasses(reload);
+	}
+
+	bool Renderer::IsPipelined() {
+		return sPipelined;
+	}
+
+	const RendererAPI &Renderer::GetRenderer() {
 		return sRendererAPI;
 	}
 
+	const FrameStatistics &Renderer::GetFrameStatistics() {
+		return sFrameStatistics;
+	}
+
 
 }
\ No newline at end of file
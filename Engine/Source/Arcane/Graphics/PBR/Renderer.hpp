@@ -6,15 +6,22 @@
 #include <Arcane/Graphics/Transform.hpp>
 #include <Arcane/Graphics/Base/RendererAPI.hpp>
 #include <Arcane/Graphics/Light.hpp>
+#include <Arcane/System/TaskGraph.hpp>
 
 #include "Material.hpp"
 #include "RenderCamera.hpp"
 
+#define AR_MAX_FRAMES_IN_FLIGHT 2
+
 namespace Arcane {
 
 	class Renderer {
 	public:
 		static void Init(const GraphicsContext &context);
+		// Adds the renderer's startup work to a larger graph instead of
+		// running it immediately. The graph must be executed on the thread
+		// that owns the context.
+		static void Init(const GraphicsContext &context, TaskGraph &graph);
 		static void Reload();
 		static void Shutdown();
 
@@ -22,9 +29,24 @@ namespace Arcane {
 		static void AddLight(const Vector3 &position, const PointLight &light);
 		static void AddLight(const Vector3 &direction, const DirectionalLight &light);
 		static void Submit(const Transform &transform, const Mesh &mesh, const Material &material);
+		// For callers that built the model matrix already, e.g. with
+		// ComputeModelMatrices().
+		static void Submit(const Matrix4 &model, const Vector3 &position, const Mesh &mesh, const Material &material);
 		static void End();
+		static void Present();
+
+		// Pipelined mode hands each finished frame to a render thread that
+		// owns the graphics context, so the next frame can be simulated
+		// while the previous one renders. End() blocks once framesInFlight
+		// (1 or 2) frames are queued. While enabled, GPU resources must not
+		// be created or modified from other threads.
+		static void SetPipelined(bool pipelined, uint32_t framesInFlight = 1);
+		static bool IsPipelined();
 
-		static RendererAPI GetRenderer();
+		static const RendererAPI &GetRenderer();
+		// Statistics of the last frame the renderer finished. In pipelined
+		// mode that frame is up to framesInFlight frames old.
+		static const FrameStatistics &GetFrameStatistics();
 	};
 
 }
\ No newline at end of file
@@ -2,18 +2,7 @@
 
 namespace Arcane {
 
-	ShadowPass::ShadowPass(const GraphicsContext &context, const RendererAPI &rendererApi, const Buffer &objectData, const Buffer &shadowData) : mContext(context), mRendererAPI(rendererApi), mObjectBuffer(objectData) {
-		CompileShader(
-			mContext, 
-			"Engine/Shaders/Shadow/Source/ShadowShader.vert", 
-			"Engine/Shaders/Shadow/Binaries/Output/ShadowShader.vert.spv"
-		);
-		CompileShader(
-			mContext,
-			"Engine/Shaders/Shadow/Source/ShadowShader.frag",
-			"Engine/Shaders/Shadow/Binaries/Output/ShadowShader.frag.spv"
-		);
-		
+	ShadowPass::ShadowPass(const GraphicsContext &context, const RendererAPI &rendererApi, const Buffer &objectData, const Buffer &shadowData, const ShaderProgram &shaders) : mContext(context), mRendererAPI(rendererApi), mObjectBuffer(objectData) {
 		const ImageFormat shadowAttachments[] = { ImageFormat::D32 };
 
 		FramebufferInfo shadowFramebufferInfo{};
@@ -39,16 +28,13 @@ namespace Arcane {
 			{ InputAttribute::Bitangent, 1, InputElementType::Vector3f32, false },
 		};
 
-		BufferRef vertexShaderBinary = ReadFileBinary("Engine/Shaders/Shadow/Binaries/Output/ShadowShader.vert.spv");
-		BufferRef fragmentShaderBinary = ReadFileBinary("Engine/Shaders/Shadow/Binaries/Output/ShadowShader.frag.spv");
-
 		PipelineInfo shadowPipelineInfo = PipelineInfo::CreateWithDefaultInfo();
 		shadowPipelineInfo.CullMode = CullMode::None;
 		shadowPipelineInfo.Descriptors = shadowDescriptors;
 		shadowPipelineInfo.DescriptorCount = 2;
 		shadowPipelineInfo.Layout = shadowInputLayout;
-		shadowPipelineInfo.VertexShaderBinary = vertexShaderBinary;
-		shadowPipelineInfo.FragmentShaderBinary = fragmentShaderBinary;
+		shadowPipelineInfo.VertexShaderBinary = shaders.Vertex.Binary;
+		shadowPipelineInfo.FragmentShaderBinary = shaders.Fragment.Binary;
 		shadowPipelineInfo.Viewport.Size = Vector2(AR_SHADOW_MAP_WIDTH, AR_SHADOW_MAP_HEIGHT);
 		shadowPipelineInfo.Scissor.Size = Vector2(AR_SHADOW_MAP_WIDTH, AR_SHADOW_MAP_HEIGHT);
 		shadowPipelineInfo.SampleCount = AR_SAMPLE_COUNT;
@@ -62,18 +48,17 @@ namespace Arcane {
 
 	ShadowPass::~ShadowPass() { }
 
-	void ShadowPass::Execute(const Camera &camera, const std::vector<RenderSubmission> &submissions) {
+	void ShadowPass::Execute(const Camera &camera, const RenderSubmissionList &submissions) {
 		mRendererAPI.BeginRenderPass(mRenderPass, mFramebuffer);
 		mRendererAPI.Clear();
 
 		ObjectData objectData;
 
-		const Matrix4 projection = camera.GetProjectionMatrix();
-		const Matrix4 view = camera.GetViewMatrix();
+		const Matrix4 viewProjection = camera.GetProjectionMatrix() * camera.GetViewMatrix();
 
 		for (const RenderSubmission &submission : submissions) {
 			objectData.Model = Matrix4::Transpose(submission.Model);
-			objectData.MVP = Matrix4::Transpose(projection * view * objectData.Model);
+			objectData.MVP = Matrix4::Transpose(viewProjection * objectData.Model);
 			objectData.Position = Vector4(submission.Position, 1.0);
 
 			mObjectBuffer.SetData(objectData);
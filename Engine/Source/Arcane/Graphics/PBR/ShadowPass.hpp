@@ -16,10 +16,10 @@ namespace Arcane {
 	class ShadowPass {
 	public:
 		ShadowPass() = default;
-		ShadowPass(const GraphicsContext &context, const RendererAPI &rendererApi, const Buffer &objectBuffer, const Buffer &shadowBuffer);
+		ShadowPass(const GraphicsContext &context, const RendererAPI &rendererApi, const Buffer &objectBuffer, const Buffer &shadowBuffer, const ShaderProgram &shaders);
   		~ShadowPass();
 
-		void Execute(const Camera &camera, const std::vector<RenderSubmission> &submissions);
+		void Execute(const Camera &camera, const RenderSubmissionList &submissions);
 
 		inline Framebuffer &GetFramebuffer() { return mFramebuffer; }
 		inline RenderPass &GetRenderPass() { return mRenderPass; }
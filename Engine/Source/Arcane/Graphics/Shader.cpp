@@ -1,6 +1,7 @@
 #include "Shader.hpp"
 
 #include <Arcane/Util/FileUtil.hpp>
+#include <Arcane/System/Memory.hpp>
 
 #include <sstream>
 
@@ -30,5 +31,28 @@ namespace Arcane {
 		AR_ASSERT(code == 0, "Shader compilation failed with code {}: ({})", code, cmd.str());
 	}
 
+	ShaderProgram GetEngineShaderProgram(const GraphicsContext &context, const std::string &name) {
+		const std::filesystem::path directory = std::filesystem::path("Engine/Shaders") / name;
+
+		ShaderProgram program;
+		program.Vertex.Context = &context;
+		program.Vertex.Source = directory / "Source" / (name + "Shader.vert");
+		program.Vertex.Output = directory / "Binaries" / "Output" / (name + "Shader.vert.spv");
+		program.Fragment.Context = &context;
+		program.Fragment.Source = directory / "Source" / (name + "Shader.frag");
+		program.Fragment.Output = directory / "Binaries" / "Output" / (name + "Shader.frag.spv");
+		return program;
+	}
+
+	void *CompileShaderTask(void *data) {
+		ShaderSource &stage = *(ShaderSource*)data;
+		MemoryTagScope tag(MemoryTag::Renderer);
+
+		CompileShader(*stage.Context, stage.Source, stage.Output);
+		// Mapped rather than read: the SPIR-V only lives until the pipeline
+		// is created, and is dropped before the shader is compiled again.
+		stage.Binary = MappedFile::Open(stage.Output.string()).GetBuffer();
+		return nullptr;
+	}
 
 }
\ No newline at end of file
@@ -2,9 +2,31 @@
 
 #include <Arcane/Core.hpp>
 #include <Arcane/Graphics/Base/GraphicsContext.hpp>
+#include <Arcane/Data/BufferData.hpp>
+#include <filesystem>
+#include <string>
 
 namespace Arcane {
 
 	void CompileShader(const GraphicsContext &context, const std::filesystem::path &path, const std::filesystem::path &output);
 
+	struct ShaderSource {
+		const GraphicsContext *Context;
+		std::filesystem::path Source;
+		std::filesystem::path Output;
+		BufferRef Binary;
+	};
+
+	struct ShaderProgram {
+		ShaderSource Vertex;
+		ShaderSource Fragment;
+	};
+
+	// Paths follow Engine/Shaders/<name>/Source/<name>Shader.{vert,frag}.
+	ShaderProgram GetEngineShaderProgram(const GraphicsContext &context, const std::string &name);
+
+	// Compiles the stage and reads the resulting SPIR-V into Binary. Does
+	// not touch the graphics API, so it can run on any thread.
+	void *CompileShaderTask(void *stage);
+
 }
\ No newline at end of file
@@ -0,0 +1,94 @@
+#include "Transform.hpp"
+
+#include <Arcane/System/CPU.hpp>
+
+namespace Arcane {
+
+	static_assert(sizeof(Transform) % sizeof(float) == 0, "Transforms are gathered as an array of floats");
+
+#if AR_MATH_SIMD
+	// Transposes four registers within each 128-bit half, so the low halves
+	// hold rows of the first four matrices and the high halves the rest.
+	AR_TARGET_AVX2 static inline void TransposeHalves(__m256 &a, __m256 &b, __m256 &c, __m256 &d) {
+		const __m256 ab0 = _mm256_unpacklo_ps(a, b);
+		const __m256 ab1 = _mm256_unpackhi_ps(a, b);
+		const __m256 cd0 = _mm256_unpacklo_ps(c, d);
+		const __m256 cd1 = _mm256_unpackhi_ps(c, d);
+
+		a = _mm256_shuffle_ps(ab0, cd0, AR_SHUFFLE_MASK(0, 1, 0, 1));
+		b = _mm256_shuffle_ps(ab0, cd0, AR_SHUFFLE_MASK(2, 3, 2, 3));
+		c = _mm256_shuffle_ps(ab1, cd1, AR_SHUFFLE_MASK(0, 1, 0, 1));
+		d = _mm256_shuffle_ps(ab1, cd1, AR_SHUFFLE_MASK(2, 3, 2, 3));
+	}
+
+	AR_TARGET_AVX2 static inline void StoreRow8(Matrix4 *out, uint32_t row, __m256 m0, __m256 m1, __m256 m2, __m256 m3) {
+		TransposeHalves(m0, m1, m2, m3);
+		const __m256 rows[4] = { m0, m1, m2, m3 };
+		for (uint32_t i = 0; i < 4; i++) {
+			_mm_storeu_ps(out[i].Data[row], _mm256_castps256_ps128(rows[i]));
+			_mm_storeu_ps(out[i + 4].Data[row], _mm256_extractf128_ps(rows[i], 1));
+		}
+	}
+
+	// The same arithmetic as Transform::GetModelMatrix(), with every
+	// register holding one value of eight transforms.
+	AR_TARGET_AVX2 static size_t ComputeModelMatricesAVX2(const Transform *transforms, Matrix4 *out, size_t count) {
+		constexpr int32_t stride = sizeof(Transform) / sizeof(float);
+		const __m256i indices = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(stride));
+		const __m256 one = _mm256_set1_ps(1.0f);
+		const __m256 two = _mm256_set1_ps(2.0f);
+		const __m128 lastRow = _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f);
+
+		const size_t blocked = count & ~(size_t)7;
+		for (size_t i = 0; i < blocked; i += 8) {
+			const Transform *block = transforms + i;
+			const __m256 px = _mm256_i32gather_ps(&block->Position.X, indices, 4);
+			const __m256 py = _mm256_i32gather_ps(&block->Position.Y, indices, 4);
+			const __m256 pz = _mm256_i32gather_ps(&block->Position.Z, indices, 4);
+			const __m256 x = _mm256_i32gather_ps(&block->Rotation.X, indices, 4);
+			const __m256 y = _mm256_i32gather_ps(&block->Rotation.Y, indices, 4);
+			const __m256 z = _mm256_i32gather_ps(&block->Rotation.Z, indices, 4);
+			const __m256 w = _mm256_i32gather_ps(&block->Rotation.W, indices, 4);
+			const __m256 sx = _mm256_i32gather_ps(&block->Scale.X, indices, 4);
+			const __m256 sy = _mm256_i32gather_ps(&block->Scale.Y, indices, 4);
+			const __m256 sz = _mm256_i32gather_ps(&block->Scale.Z, indices, 4);
+
+			const __m256 xx = _mm256_mul_ps(x, x), yy = _mm256_mul_ps(y, y), zz = _mm256_mul_ps(z, z);
+			const __m256 xy = _mm256_mul_ps(x, y), xz = _mm256_mul_ps(x, z), yz = _mm256_mul_ps(y, z);
+			const __m256 xw = _mm256_mul_ps(x, w), yw = _mm256_mul_ps(y, w), zw = _mm256_mul_ps(z, w);
+
+			// 1 - 2 * (a + b) and 2 * (a +- b)
+			const __m256 m00 = _mm256_fnmadd_ps(two, _mm256_add_ps(yy, zz), one);
+			const __m256 m11 = _mm256_fnmadd_ps(two, _mm256_add_ps(xx, zz), one);
+			const __m256 m22 = _mm256_fnmadd_ps(two, _mm256_add_ps(xx, yy), one);
+			const __m256 m01 = _mm256_mul_ps(two, _mm256_sub_ps(xy, zw));
+			const __m256 m02 = _mm256_mul_ps(two, _mm256_add_ps(xz, yw));
+			const __m256 m10 = _mm256_mul_ps(two, _mm256_add_ps(xy, zw));
+			const __m256 m12 = _mm256_mul_ps(two, _mm256_sub_ps(yz, xw));
+			const __m256 m20 = _mm256_mul_ps(two, _mm256_sub_ps(xz, yw));
+			const __m256 m21 = _mm256_mul_ps(two, _mm256_add_ps(yz, xw));
+
+			Matrix4 *matrices = out + i;
+			StoreRow8(matrices, 0, _mm256_mul_ps(m00, sx), _mm256_mul_ps(m01, sy), _mm256_mul_ps(m02, sz), px);
+			StoreRow8(matrices, 1, _mm256_mul_ps(m10, sx), _mm256_mul_ps(m11, sy), _mm256_mul_ps(m12, sz), py);
+			StoreRow8(matrices, 2, _mm256_mul_ps(m20, sx), _mm256_mul_ps(m21, sy), _mm256_mul_ps(m22, sz), pz);
+			for (uint32_t j = 0; j < 8; j++) {
+				matrices[j].Rows[3].Simd = lastRow;
+			}
+		}
+		return blocked;
+	}
+#endif
+
+	void ComputeModelMatrices(const Transform *transforms, Matrix4 *out, size_t count) {
+		size_t i = 0;
+#if AR_MATH_SIMD
+		if (HasAVX2()) i = ComputeModelMatricesAVX2(transforms, out, count);
+#endif
+
+		for (; i < count; i++) {
+			out[i] = transforms[i].GetModelMatrix();
+		}
+	}
+
+}
\ No newline at end of file
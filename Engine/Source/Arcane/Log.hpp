@@ -4,15 +4,17 @@
 #include <format>
 #include <iostream>
 
+#define AR_LOG_MESSAGE_SIZE 1024
+
 #ifdef _DEBUG
-#	define AR_ASSERT(x, ...) { if (!(x)) { ::Arcane::GetEngineLogger().Log(LogLevel::Fatal, __VA_ARGS__); __debugbreak(); } }
+#	define AR_ASSERT(x, ...) { if (!(x)) { ::Arcane::GetEngineLogger().Log(::Arcane::LogLevel::Fatal, __VA_ARGS__); __debugbreak(); } }
 #	define AR_ENGINE_LOG(level, ...) ::Arcane::GetEngineLogger().Log(level, message, __VA_ARGS__)
-#	define AR_ENGINE_TRACE(...) ::Arcane::GetEngineLogger().Log(LogLevel::Trace, __VA_ARGS__)
-#	define AR_ENGINE_INFO(...) ::Arcane::GetEngineLogger().Log(LogLevel::Info, __VA_ARGS__)
-#	define AR_ENGINE_DEBUG(...) ::Arcane::GetEngineLogger().Log(LogLevel::Debug, __VA_ARGS__)
-#	define AR_ENGINE_WARNING(...) ::Arcane::GetEngineLogger().Log(LogLevel::Warning, __VA_ARGS__)
-#	define AR_ENGINE_ERROR(...) ::Arcane::GetEngineLogger().Log(LogLevel::Error, __VA_ARGS__)
-#	define AR_ENGINE_FATAL(...) ::Arcane::GetEngineLogger().Log(LogLevel::Fatal, __VA_ARGS__)
+#	define AR_ENGINE_TRACE(...) ::Arcane::GetEngineLogger().Log(::Arcane::LogLevel::Trace, __VA_ARGS__)
+#	define AR_ENGINE_INFO(...) ::Arcane::GetEngineLogger().Log(::Arcane::LogLevel::Info, __VA_ARGS__)
+#	define AR_ENGINE_DEBUG(...) ::Arcane::GetEngineLogger().Log(::Arcane::LogLevel::Debug, __VA_ARGS__)
+#	define AR_ENGINE_WARNING(...) ::Arcane::GetEngineLogger().Log(::Arcane::LogLevel::Warning, __VA_ARGS__)
+#	define AR_ENGINE_ERROR(...) ::Arcane::GetEngineLogger().Log(::Arcane::LogLevel::Error, __VA_ARGS__)
+#	define AR_ENGINE_FATAL(...) ::Arcane::GetEngineLogger().Log(::Arcane::LogLevel::Fatal, __VA_ARGS__)
 #else
 #	define AR_ENGINE_LOG(level, ...)
 #	define AR_ENGINE_TRACE(...)
@@ -43,7 +45,13 @@ namespace Arcane {
 		template<typename ..._Args>
 		inline void Log(LogLevel level, const std::format_string<_Args...> message, _Args &&...args) {
 			if (level > mLevel) return;
-			const std::string fmt = std::format(message, std::forward<_Args>(args)...);
+
+			// Formatted on the stack so that logging never allocates. Longer
+			// messages are cut off.
+			char fmt[AR_LOG_MESSAGE_SIZE];
+			const std::format_to_n_result<char*> result = std::format_to_n(fmt, sizeof(fmt) - 1, message, std::forward<_Args>(args)...);
+			*result.out = '\0';
+
 			switch (level) {
 				case LogLevel::Fatal:   std::cout << "\033[101m\033[97m[" << mName << "] FATAL: " << fmt << "\033[0m\n"; break;
 				case LogLevel::Error:   std::cout << "\033[31m[" << mName << "] ERROR: " << fmt << "\033[0m\n"; break;
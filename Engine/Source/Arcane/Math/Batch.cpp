@@ -0,0 +1,212 @@
+#include "Batch.hpp"
+
+#include <Arcane/System/CPU.hpp>
+
+namespace Arcane {
+
+	static_assert(sizeof(Vector3) == 3 * sizeof(float), "Vector3 arrays are read as packed floats");
+
+#if AR_MATH_SIMD
+	// Eight packed Vector3s in and out of one register per component.
+	AR_TARGET_AVX2 static inline void LoadVector3x8(const Vector3 *in, __m256 &x, __m256 &y, __m256 &z) {
+		const float *data = &in->X;
+		const __m256 m03 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(data)), _mm_loadu_ps(data + 12), 1);
+		const __m256 m14 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(data + 4)), _mm_loadu_ps(data + 16), 1);
+		const __m256 m25 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(data + 8)), _mm_loadu_ps(data + 20), 1);
+
+		const __m256 xy = _mm256_shuffle_ps(m14, m25, AR_SHUFFLE_MASK(2, 3, 1, 2));
+		const __m256 yz = _mm256_shuffle_ps(m03, m14, AR_SHUFFLE_MASK(1, 2, 0, 1));
+		x = _mm256_shuffle_ps(m03, xy, AR_SHUFFLE_MASK(0, 3, 0, 2));
+		y = _mm256_shuffle_ps(yz, xy, AR_SHUFFLE_MASK(0, 2, 1, 3));
+		z = _mm256_shuffle_ps(yz, m25, AR_SHUFFLE_MASK(1, 3, 0, 3));
+	}
+
+	AR_TARGET_AVX2 static inline void StoreVector3x8(Vector3 *out, __m256 x, __m256 y, __m256 z) {
+		const __m256 xy = _mm256_shuffle_ps(x, y, AR_SHUFFLE_MASK(0, 2, 0, 2));
+		const __m256 yz = _mm256_shuffle_ps(y, z, AR_SHUFFLE_MASK(1, 3, 1, 3));
+		const __m256 zx = _mm256_shuffle_ps(z, x, AR_SHUFFLE_MASK(0, 2, 1, 3));
+
+		const __m256 m03 = _mm256_shuffle_ps(xy, zx, AR_SHUFFLE_MASK(0, 2, 0, 2));
+		const __m256 m14 = _mm256_shuffle_ps(yz, xy, AR_SHUFFLE_MASK(0, 2, 1, 3));
+		const __m256 m25 = _mm256_shuffle_ps(zx, yz, AR_SHUFFLE_MASK(1, 3, 1, 3));
+
+		float *data = &out->X;
+		_mm_storeu_ps(data, _mm256_castps256_ps128(m03));
+		_mm_storeu_ps(data + 4, _mm256_castps256_ps128(m14));
+		_mm_storeu_ps(data + 8, _mm256_castps256_ps128(m25));
+		_mm_storeu_ps(data + 12, _mm256_extractf128_ps(m03, 1));
+		_mm_storeu_ps(data + 16, _mm256_extractf128_ps(m14, 1));
+		_mm_storeu_ps(data + 20, _mm256_extractf128_ps(m25, 1));
+	}
+
+	// row . (x, y, z, w) for eight vectors at once, with w a constant.
+	AR_TARGET_AVX2 static inline __m256 DotRow8(const Vector4 &row, __m256 x, __m256 y, __m256 z, float w) {
+		__m256 sum = _mm256_fmadd_ps(_mm256_set1_ps(row.X), x, _mm256_set1_ps(row.W * w));
+		sum = _mm256_fmadd_ps(_mm256_set1_ps(row.Y), y, sum);
+		return _mm256_fmadd_ps(_mm256_set1_ps(row.Z), z, sum);
+	}
+
+	AR_TARGET_AVX2 static inline float HorizontalMin8(__m256 v) {
+		__m128 min = _mm_min_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+		min = _mm_min_ps(min, _mm_movehl_ps(min, min));
+		return _mm_cvtss_f32(_mm_min_ss(min, _mm_shuffle_ps(min, min, AR_SHUFFLE_MASK(1, 1, 1, 1))));
+	}
+
+	AR_TARGET_AVX2 static inline float HorizontalMax8(__m256 v) {
+		__m128 max = _mm_max_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+		max = _mm_max_ps(max, _mm_movehl_ps(max, max));
+		return _mm_cvtss_f32(_mm_max_ss(max, _mm_shuffle_ps(max, max, AR_SHUFFLE_MASK(1, 1, 1, 1))));
+	}
+
+	// The AVX2 kernels handle whole blocks of eight and return how many
+	// elements they did; the rest goes through the portable loops.
+
+	AR_TARGET_AVX2 static size_t TransformPointsAVX2(const Matrix4 &m, const Vector3 *in, Vector3 *out, size_t count) {
+		const size_t blocked = count & ~(size_t)7;
+		for (size_t i = 0; i < blocked; i += 8) {
+			__m256 x, y, z;
+			LoadVector3x8(in + i, x, y, z);
+			StoreVector3x8(out + i, DotRow8(m.Rows[0], x, y, z, 1.0f), DotRow8(m.Rows[1], x, y, z, 1.0f), DotRow8(m.Rows[2], x, y, z, 1.0f));
+		}
+		return blocked;
+	}
+
+	AR_TARGET_AVX2 static size_t TransformNormalsAVX2(const Matrix4 &m, const Vector3 *in, Vector3 *out, size_t count) {
+		const size_t blocked = count & ~(size_t)7;
+		for (size_t i = 0; i < blocked; i += 8) {
+			__m256 x, y, z;
+			LoadVector3x8(in + i, x, y, z);
+
+			const __m256 nx = DotRow8(m.Rows[0], x, y, z, 0.0f);
+			const __m256 ny = DotRow8(m.Rows[1], x, y, z, 0.0f);
+			const __m256 nz = DotRow8(m.Rows[2], x, y, z, 0.0f);
+			const __m256 length = _mm256_sqrt_ps(_mm256_fmadd_ps(nz, nz, _mm256_fmadd_ps(ny, ny, _mm256_mul_ps(nx, nx))));
+
+			StoreVector3x8(out + i, _mm256_div_ps(nx, length), _mm256_div_ps(ny, length), _mm256_div_ps(nz, length));
+		}
+		return blocked;
+	}
+
+	// Two rows of the product per register: each pair of lhs rows is
+	// broadcast once, so a product costs four loads and eight FMAs.
+	AR_TARGET_AVX2 static size_t MultiplyMatricesAVX2(const Matrix4 &lhs, const Matrix4 *rhs, Matrix4 *out, size_t count) {
+		__m256 lhsPairs[2][4];
+		for (uint32_t pair = 0; pair < 2; pair++) {
+			for (uint32_t k = 0; k < 4; k++) {
+				lhsPairs[pair][k] = _mm256_setr_m128(_mm_set1_ps(lhs.Data[pair * 2][k]), _mm_set1_ps(lhs.Data[pair * 2 + 1][k]));
+			}
+		}
+
+		for (size_t i = 0; i < count; i++) {
+			const __m256 r0 = _mm256_broadcast_ps(&rhs[i].Rows[0].Simd);
+			const __m256 r1 = _mm256_broadcast_ps(&rhs[i].Rows[1].Simd);
+			const __m256 r2 = _mm256_broadcast_ps(&rhs[i].Rows[2].Simd);
+			const __m256 r3 = _mm256_broadcast_ps(&rhs[i].Rows[3].Simd);
+
+			for (uint32_t pair = 0; pair < 2; pair++) {
+				__m256 sum = _mm256_mul_ps(lhsPairs[pair][0], r0);
+				sum = _mm256_fmadd_ps(lhsPairs[pair][1], r1, sum);
+				sum = _mm256_fmadd_ps(lhsPairs[pair][2], r2, sum);
+				sum = _mm256_fmadd_ps(lhsPairs[pair][3], r3, sum);
+				_mm256_storeu_ps(out[i].Data[pair * 2], sum);
+			}
+		}
+		return count;
+	}
+
+	AR_TARGET_AVX2 static size_t ComputeAABBAVX2(const Vector3 *points, size_t count, AABB &bounds) {
+		const size_t blocked = count & ~(size_t)7;
+		if (blocked == 0) return 0;
+
+		__m256 minX = _mm256_set1_ps(__FLT_MAX__), minY = minX, minZ = minX;
+		__m256 maxX = _mm256_set1_ps(-__FLT_MAX__), maxY = maxX, maxZ = maxX;
+		for (size_t i = 0; i < blocked; i += 8) {
+			__m256 x, y, z;
+			LoadVector3x8(points + i, x, y, z);
+
+			minX = _mm256_min_ps(minX, x);
+			minY = _mm256_min_ps(minY, y);
+			minZ = _mm256_min_ps(minZ, z);
+			maxX = _mm256_max_ps(maxX, x);
+			maxY = _mm256_max_ps(maxY, y);
+			maxZ = _mm256_max_ps(maxZ, z);
+		}
+
+		bounds.Min = Vector3(HorizontalMin8(minX), HorizontalMin8(minY), HorizontalMin8(minZ));
+		bounds.Max = Vector3(HorizontalMax8(maxX), HorizontalMax8(maxY), HorizontalMax8(maxZ));
+		return blocked;
+	}
+#endif
+
+	void TransformPoints(const Matrix4 &m, const Vector3 *in, Vector3 *out, size_t count) {
+		size_t i = 0;
+#if AR_MATH_SIMD
+		if (HasAVX2()) i = TransformPointsAVX2(m, in, out, count);
+#endif
+
+		// Columns, so every point is a sum of scaled columns.
+		const Matrix4 columns = Matrix4::Transpose(m);
+		for (; i < count; i++) {
+			const Vector4 p = columns.Rows[0] * in[i].X + columns.Rows[1] * in[i].Y + columns.Rows[2] * in[i].Z + columns.Rows[3];
+			out[i] = Vector3(p.X, p.Y, p.Z);
+		}
+	}
+
+	void TransformNormals(const Matrix4 &m, const Vector3 *in, Vector3 *out, size_t count) {
+		size_t i = 0;
+#if AR_MATH_SIMD
+		if (HasAVX2()) i = TransformNormalsAVX2(m, in, out, count);
+#endif
+
+		const Matrix4 columns = Matrix4::Transpose(m);
+		for (; i < count; i++) {
+			const Vector4 n = columns.Rows[0] * in[i].X + columns.Rows[1] * in[i].Y + columns.Rows[2] * in[i].Z;
+			out[i] = Vector3::Normalize(Vector3(n.X, n.Y, n.Z));
+		}
+	}
+
+	void TransformAABBs(const Matrix4 &m, const AABB *in, AABB *out, size_t count) {
+		// The transformed center plus the extent projected onto each axis,
+		// which is the same as transforming all eight corners.
+		const Matrix4 columns = Matrix4::Transpose(m);
+		const Vector4 absColumns[3] = { Vector4::Abs(columns.Rows[0]), Vector4::Abs(columns.Rows[1]), Vector4::Abs(columns.Rows[2]) };
+
+		for (size_t i = 0; i < count; i++) {
+			const Vector3 center = (in[i].Min + in[i].Max) * 0.5f;
+			const Vector3 extent = (in[i].Max - in[i].Min) * 0.5f;
+
+			const Vector4 c = columns.Rows[0] * center.X + columns.Rows[1] * center.Y + columns.Rows[2] * center.Z + columns.Rows[3];
+			const Vector4 e = absColumns[0] * extent.X + absColumns[1] * extent.Y + absColumns[2] * extent.Z;
+
+			out[i].Min = Vector3(c.X - e.X, c.Y - e.Y, c.Z - e.Z);
+			out[i].Max = Vector3(c.X + e.X, c.Y + e.Y, c.Z + e.Z);
+		}
+	}
+
+	void MultiplyMatrices(const Matrix4 &lhs, const Matrix4 *rhs, Matrix4 *out, size_t count) {
+		size_t i = 0;
+#if AR_MATH_SIMD
+		if (HasAVX2()) i = MultiplyMatricesAVX2(lhs, rhs, out, count);
+#endif
+
+		for (; i < count; i++) {
+			out[i] = lhs * rhs[i];
+		}
+	}
+
+	AABB ComputeAABB(const Vector3 *points, size_t count) {
+		AABB bounds = { Vector3::MaxValue(), Vector3::MinValue() };
+
+		size_t i = 0;
+#if AR_MATH_SIMD
+		if (HasAVX2()) i = ComputeAABBAVX2(points, count, bounds);
+#endif
+
+		for (; i < count; i++) {
+			bounds.Min = Vector3::Min(bounds.Min, points[i]);
+			bounds.Max = Vector3::Max(bounds.Max, points[i]);
+		}
+		return bounds;
+	}
+
+}
\ No newline at end of file
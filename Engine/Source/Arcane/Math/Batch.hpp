@@ -0,0 +1,27 @@
+#pragma once
+
+#include <Arcane/Core.hpp>
+#include <Arcane/Physics/AABB.hpp>
+#include "Matrix4.hpp"
+
+namespace Arcane {
+
+	// Kernels that apply one matrix to a whole array. They use AVX2 when the
+	// CPU has it and fall back to Vector4 arithmetic otherwise. Elements are
+	// independent of each other, so a large array can be split into ranges
+	// that different tasks process. out may be the same array as in.
+
+	// out[i] = (m * (in[i], 1)).xyz, without a perspective divide.
+	void TransformPoints(const Matrix4 &m, const Vector3 *in, Vector3 *out, size_t count);
+	// out[i] = normalize(m * (in[i], 0)). With non-uniform scale, m has to
+	// be the inverse transpose of the matrix used for the points.
+	void TransformNormals(const Matrix4 &m, const Vector3 *in, Vector3 *out, size_t count);
+	// The smallest boxes holding the transformed boxes; m must be affine.
+	void TransformAABBs(const Matrix4 &m, const AABB *in, AABB *out, size_t count);
+	// out[i] = lhs * rhs[i]
+	void MultiplyMatrices(const Matrix4 &lhs, const Matrix4 *rhs, Matrix4 *out, size_t count);
+
+	// An empty box (Min above Max) when there are no points.
+	AABB ComputeAABB(const Vector3 *points, size_t count);
+
+}
\ No newline at end of file
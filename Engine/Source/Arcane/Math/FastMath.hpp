@@ -0,0 +1,334 @@
+#pragma once
+
+#include <Arcane/Core.hpp>
+#include "Math.hpp"
+#include "SIMD.hpp"
+#include <bit>
+
+namespace Arcane {
+
+	// Polynomial approximations for code that does not need libm accuracy,
+	// such as particles, animation and lighting. Every function comes as a
+	// scalar, a 4-wide SSE and an 8-wide AVX2 version that agree to within
+	// the errors below; the AVX2 ones must only be called when HasAVX2() is true.
+	//
+	// The maximum errors given are the largest seen when comparing against
+	// double precision libm over the stated range. Sine and cosine reduce
+	// the angle in float arithmetic, so their absolute error grows with the
+	// size of the angle beyond that range.
+
+	enum class FastMathPrecision {
+		Low, High
+	};
+
+	// Highest power first.
+	template<FastMathPrecision _Precision>
+	struct FastMathCoefficients;
+
+	template<>
+	struct FastMathCoefficients<FastMathPrecision::High> {
+		static constexpr float Sin[] = { -2.3889859e-08f, 2.7525562e-06f, -1.9840874e-04f, 8.3333310e-03f, -1.6666667e-01f, 1.0f };
+		static constexpr float Cos[] = { -2.6051615e-07f, 2.4760495e-05f, -1.3888378e-03f, 4.1666638e-02f, -0.5f, 1.0f };
+		static constexpr float Atan[] = { 8.05374449538e-02f, -1.38776856032e-01f, 1.99777106478e-01f, -3.33329491539e-01f, 1.0f };
+		static constexpr float Exp[] = { 1.0f / 720.0f, 1.0f / 120.0f, 1.0f / 24.0f, 1.0f / 6.0f, 0.5f, 1.0f, 1.0f };
+	};
+
+	template<>
+	struct FastMathCoefficients<FastMathPrecision::Low> {
+		static constexpr float Sin[] = { -1.8524670e-04f, 8.3139502e-03f, -1.6665852e-01f, 1.0f };
+		static constexpr float Cos[] = { -1.2712436e-03f, 4.1493919e-02f, -4.9992746e-01f, 1.0f };
+		static constexpr float Atan[] = { -4.64964749e-02f, 1.5931422e-01f, -3.27622764e-01f, 1.0f };
+		static constexpr float Exp[] = { 1.0f / 24.0f, 1.0f / 6.0f, 0.5f, 1.0f, 1.0f };
+	};
+
+	// 2 * pi split so that quotient * TwoPiHigh is exact for the quotients
+	// that matter.
+	static constexpr float FastMathTwoPiHigh = 6.28125f;
+	static constexpr float FastMathTwoPiLow = 1.9353071795864769e-3f;
+	static constexpr float FastMathLn2High = 0.693359375f;
+	static constexpr float FastMathLn2Low = -2.12194440e-4f;
+	static constexpr float FastMathLog2E = 1.44269504088896341f;
+	static constexpr float FastMathTanEighthPi = 0.414213562373095f;
+	// Inputs to FastExp() are clamped to this range, which keeps the
+	// result a normal float.
+	static constexpr float FastMathExpMin = -87.0f;
+	static constexpr float FastMathExpMax = 88.0f;
+
+	template<size_t _Count>
+	inline float Horner(float x, const float (&coefficients)[_Count]) {
+		float result = coefficients[0];
+		for (size_t i = 1; i < _Count; i++) result = result * x + coefficients[i];
+		return result;
+	}
+
+	// Reduces an angle to [-pi/2, pi/2] with the same sine. The cosine of
+	// the angle is sign times the cosine of the result.
+	inline float ReduceSinCosAngle(float angle, float &sign) {
+		const float quotient = (float)(int32_t)(angle * (1.0f / TwoPi) + (angle >= 0.0f ? 0.5f : -0.5f));
+		float y = (angle - quotient * FastMathTwoPiHigh) - quotient * FastMathTwoPiLow;
+
+		sign = 1.0f;
+		if (y > HalfPi) {
+			y = Pi - y;
+			sign = -1.0f;
+		} else if (y < -HalfPi) {
+			y = -Pi - y;
+			sign = -1.0f;
+		}
+		return y;
+	}
+
+	// Max error over [-100pi, 100pi]: 2.5e-7 with High, 2e-6 with Low.
+	template<FastMathPrecision _Precision = FastMathPrecision::High>
+	inline float FastSin(float angle) {
+		float sign;
+		const float y = ReduceSinCosAngle(angle, sign);
+		return Horner(y * y, FastMathCoefficients<_Precision>::Sin) * y;
+	}
+
+	// Max error over [-100pi, 100pi]: 3e-7 with High, 1e-5 with Low.
+	template<FastMathPrecision _Precision = FastMathPrecision::High>
+	inline float FastCos(float angle) {
+		float sign;
+		const float y = ReduceSinCosAngle(angle, sign);
+		return Horner(y * y, FastMathCoefficients<_Precision>::Cos) * sign;
+	}
+
+	// FastSin() and FastCos() with a single reduction.
+	template<FastMathPrecision _Precision = FastMathPrecision::High>
+	inline void SinCos(float angle, float &sin, float &cos) {
+		float sign;
+		const float y = ReduceSinCosAngle(angle, sign);
+		const float y2 = y * y;
+		sin = Horner(y2, FastMathCoefficients<_Precision>::Sin) * y;
+		cos = Horner(y2, FastMathCoefficients<_Precision>::Cos) * sign;
+	}
+
+	// 1 / sqrt(value) for positive values. Max relative error: 3e-7 with
+	// High, 3.5e-4 with Low (1.8e-3 in AR_MATH_SCALAR builds).
+	template<FastMathPrecision _Precision = FastMathPrecision::High>
+	inline float RSqrt(float value) {
+#if AR_MATH_SIMD
+		float estimate = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(value)));
+#else
+		float estimate = std::bit_cast<float>(0x5F375A86u - (std::bit_cast<uint32_t>(value) >> 1));
+		estimate *= 1.5f - 0.5f * value * estimate * estimate;
+#endif
+		if constexpr (_Precision == FastMathPrecision::High) {
+			estimate *= 1.5f - 0.5f * value * estimate * estimate;
+#if !AR_MATH_SIMD
+			estimate *= 1.5f - 0.5f * value * estimate * estimate;
+#endif
+		}
+		return estimate;
+	}
+
+	// Max error in radians: 3e-7 with High, 2.1e-4 with Low. Returns 0 for
+	// (0, 0).
+	template<FastMathPrecision _Precision = FastMathPrecision::High>
+	inline float FastAtan2(float y, float x) {
+		const float absX = Abs(x), absY = Abs(y);
+		const float largest = Max(absX, absY);
+		float a = largest > 0.0f ? Min(absX, absY) / largest : 0.0f;
+
+		// atan(a) for a in [0, 1].
+		float offset = 0.0f;
+		if constexpr (_Precision == FastMathPrecision::High) {
+			if (a > FastMathTanEighthPi) {
+				offset = Pi / 4.0f;
+				a = (a - 1.0f) / (a + 1.0f);
+			}
+		}
+		float result = offset + Horner(a * a, FastMathCoefficients<_Precision>::Atan) * a;
+
+		if (absY > absX) result = HalfPi - result;
+		if (x < 0.0f) result = Pi - result;
+		return y < 0.0f ? -result : result;
+	}
+
+	// Max relative error over [-87, 88]: 3e-7 with High, 6e-5 with Low.
+	template<FastMathPrecision _Precision = FastMathPrecision::High>
+	inline float FastExp(float value) {
+		const float x = Clamp(value, FastMathExpMin, FastMathExpMax);
+		const float t = x * FastMathLog2E;
+		const int32_t n = (int32_t)(t + (t >= 0.0f ? 0.5f : -0.5f));
+		const float r = (x - (float)n * FastMathLn2High) - (float)n * FastMathLn2Low;
+		return Horner(r, FastMathCoefficients<_Precision>::Exp) * std::bit_cast<float>((uint32_t)(n + 127) << 23);
+	}
+
+#if AR_MATH_SIMD
+	template<size_t _Count>
+	inline __m128 Horner(__m128 x, const float (&coefficients)[_Count]) {
+		__m128 result = _mm_set1_ps(coefficients[0]);
+		for (size_t i = 1; i < _Count; i++) result = MulAdd(result, x, _mm_set1_ps(coefficients[i]));
+		return result;
+	}
+
+	inline __m128 ReduceSinCosAngle(__m128 angle, __m128 &sign) {
+		const __m128 quotient = _mm_cvtepi32_ps(_mm_cvtps_epi32(_mm_mul_ps(angle, _mm_set1_ps(1.0f / TwoPi))));
+		__m128 y = _mm_sub_ps(angle, _mm_mul_ps(quotient, _mm_set1_ps(FastMathTwoPiHigh)));
+		y = _mm_sub_ps(y, _mm_mul_ps(quotient, _mm_set1_ps(FastMathTwoPiLow)));
+
+		// Reflect around +-pi/2 where y is outside [-pi/2, pi/2].
+		const __m128 signMask = _mm_set1_ps(-0.0f);
+		const __m128 reflected = _mm_sub_ps(_mm_or_ps(_mm_and_ps(y, signMask), _mm_set1_ps(Pi)), y);
+		const __m128 outside = _mm_cmpgt_ps(_mm_andnot_ps(signMask, y), _mm_set1_ps(HalfPi));
+
+		sign = Select(outside, _mm_set1_ps(-1.0f), _mm_set1_ps(1.0f));
+		return Select(outside, reflected, y);
+	}
+
+	template<FastMathPrecision _Precision = FastMathPrecision::High>
+	inline __m128 FastSin(__m128 angle) {
+		__m128 sign;
+		const __m128 y = ReduceSinCosAngle(angle, sign);
+		return _mm_mul_ps(Horner(_mm_mul_ps(y, y), FastMathCoefficients<_Precision>::Sin), y);
+	}
+
+	template<FastMathPrecision _Precision = FastMathPrecision::High>
+	inline __m128 FastCos(__m128 angle) {
+		__m128 sign;
+		const __m128 y = ReduceSinCosAngle(angle, sign);
+		return _mm_mul_ps(Horner(_mm_mul_ps(y, y), FastMathCoefficients<_Precision>::Cos), sign);
+	}
+
+	template<FastMathPrecision _Precision = FastMathPrecision::High>
+	inline void SinCos(__m128 angle, __m128 &sin, __m128 &cos) {
+		__m128 sign;
+		const __m128 y = ReduceSinCosAngle(angle, sign);
+		const __m128 y2 = _mm_mul_ps(y, y);
+		sin = _mm_mul_ps(Horner(y2, FastMathCoefficients<_Precision>::Sin), y);
+		cos = _mm_mul_ps(Horner(y2, FastMathCoefficients<_Precision>::Cos), sign);
+	}
+
+	template<FastMathPrecision _Precision = FastMathPrecision::High>
+	inline __m128 RSqrt(__m128 value) {
+		__m128 estimate = _mm_rsqrt_ps(value);
+		if constexpr (_Precision == FastMathPrecision::High) {
+			const __m128 halfValue = _mm_mul_ps(value, _mm_set1_ps(0.5f));
+			estimate = _mm_mul_ps(estimate, _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(halfValue, _mm_mul_ps(estimate, estimate))));
+		}
+		return estimate;
+	}
+
+	template<FastMathPrecision _Precision = FastMathPrecision::High>
+	inline __m128 FastAtan2(__m128 y, __m128 x) {
+		const __m128 signMask = _mm_set1_ps(-0.0f);
+		const __m128 absX = _mm_andnot_ps(signMask, x);
+		const __m128 absY = _mm_andnot_ps(signMask, y);
+		const __m128 largest = _mm_max_ps(absX, absY);
+		// The mask turns 0 / 0 into 0.
+		__m128 a = _mm_and_ps(_mm_div_ps(_mm_min_ps(absX, absY), largest), _mm_cmpgt_ps(largest, _mm_setzero_ps()));
+
+		__m128 offset = _mm_setzero_ps();
+		if constexpr (_Precision == FastMathPrecision::High) {
+			const __m128 above = _mm_cmpgt_ps(a, _mm_set1_ps(FastMathTanEighthPi));
+			const __m128 one = _mm_set1_ps(1.0f);
+			offset = _mm_and_ps(above, _mm_set1_ps(Pi / 4.0f));
+			a = Select(above, _mm_div_ps(_mm_sub_ps(a, one), _mm_add_ps(a, one)), a);
+		}
+		__m128 result = MulAdd(Horner(_mm_mul_ps(a, a), FastMathCoefficients<_Precision>::Atan), a, offset);
+
+		result = Select(_mm_cmpgt_ps(absY, absX), _mm_sub_ps(_mm_set1_ps(HalfPi), result), result);
+		result = Select(_mm_cmplt_ps(x, _mm_setzero_ps()), _mm_sub_ps(_mm_set1_ps(Pi), result), result);
+		return Select(_mm_cmplt_ps(y, _mm_setzero_ps()), _mm_xor_ps(result, signMask), result);
+	}
+
+	template<FastMathPrecision _Precision = FastMathPrecision::High>
+	inline __m128 FastExp(__m128 value) {
+		const __m128 x = _mm_min_ps(_mm_max_ps(value, _mm_set1_ps(FastMathExpMin)), _mm_set1_ps(FastMathExpMax));
+		const __m128i n = _mm_cvtps_epi32(_mm_mul_ps(x, _mm_set1_ps(FastMathLog2E)));
+		const __m128 nf = _mm_cvtepi32_ps(n);
+		const __m128 r = _mm_sub_ps(_mm_sub_ps(x, _mm_mul_ps(nf, _mm_set1_ps(FastMathLn2High))), _mm_mul_ps(nf, _mm_set1_ps(FastMathLn2Low)));
+		const __m128 scale = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(n, _mm_set1_epi32(127)), 23));
+		return _mm_mul_ps(Horner(r, FastMathCoefficients<_Precision>::Exp), scale);
+	}
+
+	template<size_t _Count>
+	AR_TARGET_AVX2 inline __m256 Horner(__m256 x, const float (&coefficients)[_Count]) {
+		__m256 result = _mm256_set1_ps(coefficients[0]);
+		for (size_t i = 1; i < _Count; i++) result = _mm256_fmadd_ps(result, x, _mm256_set1_ps(coefficients[i]));
+		return result;
+	}
+
+	AR_TARGET_AVX2 inline __m256 ReduceSinCosAngle(__m256 angle, __m256 &sign) {
+		const __m256 quotient = _mm256_round_ps(_mm256_mul_ps(angle, _mm256_set1_ps(1.0f / TwoPi)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+		__m256 y = _mm256_fnmadd_ps(quotient, _mm256_set1_ps(FastMathTwoPiHigh), angle);
+		y = _mm256_fnmadd_ps(quotient, _mm256_set1_ps(FastMathTwoPiLow), y);
+
+		const __m256 signMask = _mm256_set1_ps(-0.0f);
+		const __m256 reflected = _mm256_sub_ps(_mm256_or_ps(_mm256_and_ps(y, signMask), _mm256_set1_ps(Pi)), y);
+		const __m256 outside = _mm256_cmp_ps(_mm256_andnot_ps(signMask, y), _mm256_set1_ps(HalfPi), _CMP_GT_OQ);
+
+		sign = _mm256_blendv_ps(_mm256_set1_ps(1.0f), _mm256_set1_ps(-1.0f), outside);
+		return _mm256_blendv_ps(y, reflected, outside);
+	}
+
+	template<FastMathPrecision _Precision = FastMathPrecision::High>
+	AR_TARGET_AVX2 inline __m256 FastSin(__m256 angle) {
+		__m256 sign;
+		const __m256 y = ReduceSinCosAngle(angle, sign);
+		return _mm256_mul_ps(Horner(_mm256_mul_ps(y, y), FastMathCoefficients<_Precision>::Sin), y);
+	}
+
+	template<FastMathPrecision _Precision = FastMathPrecision::High>
+	AR_TARGET_AVX2 inline __m256 FastCos(__m256 angle) {
+		__m256 sign;
+		const __m256 y = ReduceSinCosAngle(angle, sign);
+		return _mm256_mul_ps(Horner(_mm256_mul_ps(y, y), FastMathCoefficients<_Precision>::Cos), sign);
+	}
+
+	template<FastMathPrecision _Precision = FastMathPrecision::High>
+	AR_TARGET_AVX2 inline void SinCos(__m256 angle, __m256 &sin, __m256 &cos) {
+		__m256 sign;
+		const __m256 y = ReduceSinCosAngle(angle, sign);
+		const __m256 y2 = _mm256_mul_ps(y, y);
+		sin = _mm256_mul_ps(Horner(y2, FastMathCoefficients<_Precision>::Sin), y);
+		cos = _mm256_mul_ps(Horner(y2, FastMathCoefficients<_Precision>::Cos), sign);
+	}
+
+	template<FastMathPrecision _Precision = FastMathPrecision::High>
+	AR_TARGET_AVX2 inline __m256 RSqrt(__m256 value) {
+		__m256 estimate = _mm256_rsqrt_ps(value);
+		if constexpr (_Precision == FastMathPrecision::High) {
+			const __m256 halfValue = _mm256_mul_ps(value, _mm256_set1_ps(0.5f));
+			estimate = _mm256_mul_ps(estimate, _mm256_fnmadd_ps(halfValue, _mm256_mul_ps(estimate, estimate), _mm256_set1_ps(1.5f)));
+		}
+		return estimate;
+	}
+
+	template<FastMathPrecision _Precision = FastMathPrecision::High>
+	AR_TARGET_AVX2 inline __m256 FastAtan2(__m256 y, __m256 x) {
+		const __m256 signMask = _mm256_set1_ps(-0.0f);
+		const __m256 zero = _mm256_setzero_ps();
+		const __m256 absX = _mm256_andnot_ps(signMask, x);
+		const __m256 absY = _mm256_andnot_ps(signMask, y);
+		const __m256 largest = _mm256_max_ps(absX, absY);
+		__m256 a = _mm256_and_ps(_mm256_div_ps(_mm256_min_ps(absX, absY), largest), _mm256_cmp_ps(largest, zero, _CMP_GT_OQ));
+
+		__m256 offset = zero;
+		if constexpr (_Precision == FastMathPrecision::High) {
+			const __m256 above = _mm256_cmp_ps(a, _mm256_set1_ps(FastMathTanEighthPi), _CMP_GT_OQ);
+			const __m256 one = _mm256_set1_ps(1.0f);
+			offset = _mm256_and_ps(above, _mm256_set1_ps(Pi / 4.0f));
+			a = _mm256_blendv_ps(a, _mm256_div_ps(_mm256_sub_ps(a, one), _mm256_add_ps(a, one)), above);
+		}
+		__m256 result = _mm256_fmadd_ps(Horner(_mm256_mul_ps(a, a), FastMathCoefficients<_Precision>::Atan), a, offset);
+
+		result = _mm256_blendv_ps(result, _mm256_sub_ps(_mm256_set1_ps(HalfPi), result), _mm256_cmp_ps(absY, absX, _CMP_GT_OQ));
+		result = _mm256_blendv_ps(result, _mm256_sub_ps(_mm256_set1_ps(Pi), result), _mm256_cmp_ps(x, zero, _CMP_LT_OQ));
+		return _mm256_blendv_ps(result, _mm256_xor_ps(result, signMask), _mm256_cmp_ps(y, zero, _CMP_LT_OQ));
+	}
+
+	template<FastMathPrecision _Precision = FastMathPrecision::High>
+	AR_TARGET_AVX2 inline __m256 FastExp(__m256 value) {
+		const __m256 x = _mm256_min_ps(_mm256_max_ps(value, _mm256_set1_ps(FastMathExpMin)), _mm256_set1_ps(FastMathExpMax));
+		const __m256 nf = _mm256_round_ps(_mm256_mul_ps(x, _mm256_set1_ps(FastMathLog2E)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+		const __m256 r = _mm256_fnmadd_ps(nf, _mm256_set1_ps(FastMathLn2Low), _mm256_fnmadd_ps(nf, _mm256_set1_ps(FastMathLn2High), x));
+		const __m256i n = _mm256_cvtps_epi32(nf);
+		const __m256 scale = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(n, _mm256_set1_epi32(127)), 23));
+		return _mm256_mul_ps(Horner(r, FastMathCoefficients<_Precision>::Exp), scale);
+	}
+#endif
+
+}
\ No newline at end of file
@@ -5,7 +5,7 @@
 
 namespace Arcane {
 
-	class Matrix4 {
+	class alignas(16) Matrix4 {
 	public:
 		static Matrix4 Identity(float scale = 1.0f) {
 			return Matrix4(
@@ -17,74 +17,190 @@ namespace Arcane {
 		}
 
 		static Matrix4 Transpose(const Matrix4 &matrix) {
+#if AR_MATH_SIMD
+			Matrix4 result = matrix;
+			_MM_TRANSPOSE4_PS(result.Rows[0].Simd, result.Rows[1].Simd, result.Rows[2].Simd, result.Rows[3].Simd);
+			return result;
+#else
 			return Matrix4(
 				{ matrix.M00, matrix.M10, matrix.M20, matrix.M30 },
 				{ matrix.M01, matrix.M11, matrix.M21, matrix.M31 },
 				{ matrix.M02, matrix.M12, matrix.M22, matrix.M32 },
 				{ matrix.M03, matrix.M13, matrix.M23, matrix.M33 }
 			);
+#endif
 		}
 
-		static Matrix4 Translate(const Matrix4 &m, const Vector3 &translation) {
-			Matrix4 translate = {
-				{ 1, 0, 0, translation.X },
-				{ 0, 1, 0, translation.Y },
-				{ 0, 0, 1, translation.Z },
-				{ 0, 0, 0, 1 }
-			};
+		// The transforms below are m times the corresponding matrix, but only
+		// the columns that matrix changes are computed.
 
-			return m * translate;
+		static Matrix4 Translate(const Matrix4 &m, const Vector3 &translation) {
+			Matrix4 result = m;
+			for (uint32_t i = 0; i < 4; i++) {
+				result.Data[i][3] += m.Data[i][0] * translation.X + m.Data[i][1] * translation.Y + m.Data[i][2] * translation.Z;
+			}
+			return result;
 		}
 
 		static Matrix4 RotateX(const Matrix4 &m, float angle) {
 			const float s = Sin(angle);
 			const float c = Cos(angle);
-		
-			const Matrix4 rotate = {
-				{ 1, 0, 0, 0 },
-				{ 0, c, -s, 0 },
-				{ 0, s, c, 0 },
-				{ 0, 0, 0, 1 }	
-			};
 
-			return m * rotate;
+#if AR_MATH_SIMD
+			return RotatePlane<0, 2, 1, 3>(m, _mm_setr_ps(1, c, c, 1), _mm_setr_ps(0, s, -s, 0));
+#else
+			Matrix4 result = m;
+			for (uint32_t i = 0; i < 4; i++) {
+				result.Data[i][1] = m.Data[i][1] * c + m.Data[i][2] * s;
+				result.Data[i][2] = m.Data[i][2] * c - m.Data[i][1] * s;
+			}
+			return result;
+#endif
 		}
 
 		static Matrix4 RotateY(const Matrix4 &m, float angle) {
 			const float s = Sin(angle);
 			const float c = Cos(angle);
 
-			const Matrix4 rotate = {
-				{ c, 0, s, 0 },
-				{ 0, 1, 0, 0 },
-				{ -s, 0, c, 0 },
-				{ 0, 0, 0, 1}
-			};
-
-			return m * rotate;
+#if AR_MATH_SIMD
+			return RotatePlane<2, 1, 0, 3>(m, _mm_setr_ps(c, 1, c, 1), _mm_setr_ps(-s, 0, s, 0));
+#else
+			Matrix4 result = m;
+			for (uint32_t i = 0; i < 4; i++) {
+				result.Data[i][0] = m.Data[i][0] * c - m.Data[i][2] * s;
+				result.Data[i][2] = m.Data[i][2] * c + m.Data[i][0] * s;
+			}
+			return result;
+#endif
 		}
 
 		static Matrix4 RotateZ(const Matrix4 &m, float angle) {
 			const float s = Sin(angle);
 			const float c = Cos(angle);
 
-			const Matrix4 rotate = {
-				{ c, -s, 0, 0 },
-				{ s, c, 0, 0 },
-				{ 0, 0, 1, 0 },
-				{ 0, 0, 0, 1 }
-			};
-
-			return m * rotate;
+#if AR_MATH_SIMD
+			return RotatePlane<1, 0, 2, 3>(m, _mm_setr_ps(c, c, 1, 1), _mm_setr_ps(s, -s, 0, 0));
+#else
+			Matrix4 result = m;
+			for (uint32_t i = 0; i < 4; i++) {
+				result.Data[i][0] = m.Data[i][0] * c + m.Data[i][1] * s;
+				result.Data[i][1] = m.Data[i][1] * c - m.Data[i][0] * s;
+			}
+			return result;
+#endif
 		}
 
 		static Matrix4 Scale(const Matrix4 &m, const Vector3 &scale) {
-			return m * Matrix4(
-				{ scale.X, 0, 0, 0 },
-				{ 0, scale.Y, 0, 0 },
-				{ 0, 0, scale.Z, 0 },
-				{ 0, 0, 0, 1 }
+			const Vector4 columnScale(scale, 1.0f);
+			return Matrix4(
+				m.Rows[0] * columnScale,
+				m.Rows[1] * columnScale,
+				m.Rows[2] * columnScale,
+				m.Rows[3] * columnScale
+			);
+		}
+
+		// The result is not finite if the matrix is singular.
+		static Matrix4 Inverse(const Matrix4 &m) {
+#if AR_MATH_SIMD
+			// Block-wise inversion on the four 2x2 submatrices
+			//   | A B |
+			//   | C D |
+			// each held as one register, using adjugates (written A#) to avoid
+			// inverting any of them.
+			const __m128 a = _mm_movelh_ps(m.Rows[0].Simd, m.Rows[1].Simd);
+			const __m128 b = _mm_movehl_ps(m.Rows[1].Simd, m.Rows[0].Simd);
+			const __m128 c = _mm_movelh_ps(m.Rows[2].Simd, m.Rows[3].Simd);
+			const __m128 d = _mm_movehl_ps(m.Rows[3].Simd, m.Rows[2].Simd);
+
+			// (|A|, |B|, |C|, |D|)
+			const __m128 determinants = _mm_sub_ps(
+				_mm_mul_ps(
+					_mm_shuffle_ps(m.Rows[0].Simd, m.Rows[2].Simd, AR_SHUFFLE_MASK(0, 2, 0, 2)),
+					_mm_shuffle_ps(m.Rows[1].Simd, m.Rows[3].Simd, AR_SHUFFLE_MASK(1, 3, 1, 3))
+				),
+				_mm_mul_ps(
+					_mm_shuffle_ps(m.Rows[0].Simd, m.Rows[2].Simd, AR_SHUFFLE_MASK(1, 3, 1, 3)),
+					_mm_shuffle_ps(m.Rows[1].Simd, m.Rows[3].Simd, AR_SHUFFLE_MASK(0, 2, 0, 2))
+				)
+			);
+			const __m128 detA = Splat<0>(determinants);
+			const __m128 detB = Splat<1>(determinants);
+			const __m128 detC = Splat<2>(determinants);
+			const __m128 detD = Splat<3>(determinants);
+
+			const __m128 adjDC = AdjugateMul2x2(d, c);
+			const __m128 adjAB = AdjugateMul2x2(a, b);
+
+			// The adjugates of the four blocks of the inverse.
+			__m128 x = _mm_sub_ps(_mm_mul_ps(detD, a), Mul2x2(b, adjDC));
+			__m128 w = _mm_sub_ps(_mm_mul_ps(detA, d), Mul2x2(c, adjAB));
+			__m128 y = _mm_sub_ps(_mm_mul_ps(detB, c), MulAdjugate2x2(d, adjAB));
+			__m128 z = _mm_sub_ps(_mm_mul_ps(detC, b), MulAdjugate2x2(a, adjDC));
+
+			// |M| = |A||D| + |B||C| - tr((A#B)(D#C))
+			const __m128 trace = HorizontalSum(_mm_mul_ps(adjAB, Swizzle<0, 2, 1, 3>(adjDC)));
+			const __m128 det = _mm_sub_ps(MulAdd(detA, detD, _mm_mul_ps(detB, detC)), trace);
+			const __m128 invDet = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), det);
+
+			x = _mm_mul_ps(x, invDet);
+			y = _mm_mul_ps(y, invDet);
+			z = _mm_mul_ps(z, invDet);
+			w = _mm_mul_ps(w, invDet);
+
+			// Taking the adjugates back and storing the blocks as rows in one go.
+			Matrix4 result;
+			result.Rows[0].Simd = _mm_shuffle_ps(x, y, AR_SHUFFLE_MASK(3, 1, 3, 1));
+			result.Rows[1].Simd = _mm_shuffle_ps(x, y, AR_SHUFFLE_MASK(2, 0, 2, 0));
+			result.Rows[2].Simd = _mm_shuffle_ps(z, w, AR_SHUFFLE_MASK(3, 1, 3, 1));
+			result.Rows[3].Simd = _mm_shuffle_ps(z, w, AR_SHUFFLE_MASK(2, 0, 2, 0));
+			return result;
+#else
+			// Cofactors of the first two rows' 2x2 minors paired with those of
+			// the last two rows.
+			const float s0 = m.M00 * m.M11 - m.M10 * m.M01;
+			const float s1 = m.M00 * m.M12 - m.M10 * m.M02;
+			const float s2 = m.M00 * m.M13 - m.M10 * m.M03;
+			const float s3 = m.M01 * m.M12 - m.M11 * m.M02;
+			const float s4 = m.M01 * m.M13 - m.M11 * m.M03;
+			const float s5 = m.M02 * m.M13 - m.M12 * m.M03;
+
+			const float c5 = m.M22 * m.M33 - m.M32 * m.M23;
+			const float c4 = m.M21 * m.M33 - m.M31 * m.M23;
+			const float c3 = m.M21 * m.M32 - m.M31 * m.M22;
+			const float c2 = m.M20 * m.M33 - m.M30 * m.M23;
+			const float c1 = m.M20 * m.M32 - m.M30 * m.M22;
+			const float c0 = m.M20 * m.M31 - m.M30 * m.M21;
+
+			const float invDet = 1.0f / (s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0);
+
+			return Matrix4(
+				{
+					( m.M11 * c5 - m.M12 * c4 + m.M13 * c3) * invDet,
+					(-m.M01 * c5 + m.M02 * c4 - m.M03 * c3) * invDet,
+					( m.M31 * s5 - m.M32 * s4 + m.M33 * s3) * invDet,
+					(-m.M21 * s5 + m.M22 * s4 - m.M23 * s3) * invDet
+				},
+				{
+					(-m.M10 * c5 + m.M12 * c2 - m.M13 * c1) * invDet,
+					( m.M00 * c5 - m.M02 * c2 + m.M03 * c1) * invDet,
+					(-m.M30 * s5 + m.M32 * s2 - m.M33 * s1) * invDet,
+					( m.M20 * s5 - m.M22 * s2 + m.M23 * s1) * invDet
+				},
+				{
+					( m.M10 * c4 - m.M11 * c2 + m.M13 * c0) * invDet,
+					(-m.M00 * c4 + m.M01 * c2 - m.M03 * c0) * invDet,
+					( m.M30 * s4 - m.M31 * s2 + m.M33 * s0) * invDet,
+					(-m.M20 * s4 + m.M21 * s2 - m.M23 * s0) * invDet
+				},
+				{
+					(-m.M10 * c3 + m.M11 * c1 - m.M12 * c0) * invDet,
+					( m.M00 * c3 - m.M01 * c1 + m.M02 * c0) * invDet,
+					(-m.M30 * s3 + m.M31 * s1 - m.M32 * s0) * invDet,
+					( m.M20 * s3 - m.M21 * s1 + m.M22 * s0) * invDet
+				}
 			);
+#endif
 		}
 
 		static Matrix4 LookAtLH(const Vector3 &position, const Vector3 &target, const Vector3 &up) {
@@ -190,14 +306,9 @@ namespace Arcane {
 			Rows[2] = r2;
 			Rows[3] = r3;
 		}
-		Matrix4(const Matrix4 &m) {
-			std::memcpy(Data, m.Data, 16 * sizeof(float));
-		}
-		Matrix4 &operator=(const Matrix4 &other) {
-			std::memcpy(Data, other.Data, 16 * sizeof(float));
-			return *this;
-		}
-		~Matrix4() { }
+		Matrix4(const Matrix4 &m) = default;
+		Matrix4 &operator=(const Matrix4 &other) = default;
+		~Matrix4() = default;
 
 		inline Matrix4 operator+(const Matrix4 &m) const {
 			return Matrix4(
@@ -219,6 +330,16 @@ namespace Arcane {
 
 		inline Matrix4 operator*(const Matrix4 &m) const {
 			Matrix4 result;
+#if AR_MATH_SIMD
+			// Each row of the result is a combination of the rows of m.
+			for (uint32_t i = 0; i < 4; i++) {
+				const __m128 row = Rows[i].Simd;
+				__m128 sum = _mm_mul_ps(Splat<0>(row), m.Rows[0].Simd);
+				sum = MulAdd(Splat<1>(row), m.Rows[1].Simd, sum);
+				sum = MulAdd(Splat<2>(row), m.Rows[2].Simd, sum);
+				result.Rows[i].Simd = MulAdd(Splat<3>(row), m.Rows[3].Simd, sum);
+			}
+#else
 			for (uint32_t i = 0; i < 4; i++) {
 				for (uint32_t j = 0; j < 4; j++) {
 					float sum = 0.0f;
@@ -228,19 +349,32 @@ namespace Arcane {
 					result.Data[i][j] = sum;
 				}
 			}
+#endif
 			return result;
 		}
 
-		inline Vector4 operator*(const Vector4 &m) const {
+		inline Vector4 operator*(const Vector4 &v) const {
+#if AR_MATH_SIMD
+			// A combination of the columns, which is cheaper to get by
+			// transposing than summing four dot products.
+			__m128 c0 = Rows[0].Simd, c1 = Rows[1].Simd, c2 = Rows[2].Simd, c3 = Rows[3].Simd;
+			_MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+
+			__m128 sum = _mm_mul_ps(c0, Splat<0>(v.Simd));
+			sum = MulAdd(c1, Splat<1>(v.Simd), sum);
+			sum = MulAdd(c2, Splat<2>(v.Simd), sum);
+			return Vector4(MulAdd(c3, Splat<3>(v.Simd), sum));
+#else
 			Vector4 result;
 			for (uint32_t i = 0; i < 4; i++) {
 				float sum = 0.0f;
 				for (uint32_t k = 0; k < 4; k++) {
-					sum += Data[i][k] * m.Data[k];
+					sum += Data[i][k] * v.Data[k];
 				}
 				result.Data[i] = sum;
 			}
 			return result;
+#endif
 		}
 
 		inline Matrix4 &operator+=(const Matrix4 &m) {
@@ -260,23 +394,42 @@ namespace Arcane {
 		}
 
 		inline Matrix4 &operator*=(const Matrix4 &m) {
+			*this = *this * m;
+			return *this;
+		}
+
+#if AR_MATH_SIMD
+	private:
+		// Every row becomes row * keep + row.<swizzle> * mix, which is how a
+		// rotation about one axis mixes the other two columns.
+		template<int _X, int _Y, int _Z, int _W>
+		static Matrix4 RotatePlane(const Matrix4 &m, __m128 keep, __m128 mix) {
 			Matrix4 result;
 			for (uint32_t i = 0; i < 4; i++) {
-				for (uint32_t j = 0; j < 4; j++) {
-					float sum = 0.0f;
-					for (uint32_t k = 0; k < 4; k++) {
-						sum += Data[i][k] * m.Data[k][j];
-					}
-					result.Data[i][j] = sum;
-				}
+				const __m128 row = m.Rows[i].Simd;
+				result.Rows[i].Simd = MulAdd(Swizzle<_X, _Y, _Z, _W>(row), mix, _mm_mul_ps(row, keep));
 			}
+			return result;
+		}
 
-			for (uint32_t i = 0; i < 4; i++) {
-				Rows[i] = result.Rows[i];
-			}
-			return *this;
+		// 2x2 matrices stored row-major in one register.
+
+		// a * b
+		static __m128 Mul2x2(__m128 a, __m128 b) {
+			return MulAdd(a, Swizzle<0, 3, 0, 3>(b), _mm_mul_ps(Swizzle<1, 0, 3, 2>(a), Swizzle<2, 1, 2, 1>(b)));
+		}
+
+		// a# * b
+		static __m128 AdjugateMul2x2(__m128 a, __m128 b) {
+			return _mm_sub_ps(_mm_mul_ps(Swizzle<3, 3, 0, 0>(a), b), _mm_mul_ps(Swizzle<1, 1, 2, 2>(a), Swizzle<2, 3, 0, 1>(b)));
 		}
 
+		// a * b#
+		static __m128 MulAdjugate2x2(__m128 a, __m128 b) {
+			return _mm_sub_ps(_mm_mul_ps(a, Swizzle<3, 0, 3, 0>(b)), _mm_mul_ps(Swizzle<1, 0, 3, 2>(a), Swizzle<2, 1, 2, 1>(b)));
+		}
+#endif
+
 	public:
 		union {
 			struct {
@@ -290,4 +443,6 @@ namespace Arcane {
 		};
 	};
 
+	static_assert(sizeof(Matrix4) == 64, "Matrix4 is uploaded to the GPU as a mat4");
+
 }
\ No newline at end of file
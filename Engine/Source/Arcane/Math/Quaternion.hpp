@@ -2,34 +2,70 @@
 
 #include "Math.hpp"
 #include "Vector3.hpp"
+#include <cmath>
 
 namespace Arcane {
 
+	// A rotation as a unit quaternion, with W the real part.
 	class Quaternion {
+	public:
+		static Quaternion Identity() { return Quaternion(0, 0, 0, 1); }
+
+		// angle is in radians, axis must be normalized.
+		static Quaternion AxisAngle(const Vector3 &axis, float angle) {
+			const float s = Sin(angle * 0.5f);
+			return Quaternion(axis.X * s, axis.Y * s, axis.Z * s, Cos(angle * 0.5f));
+		}
+
+		// Euler angles in degrees, in the convention the engine has always
+		// used for transforms: the rotation matrix is RotateX(-x), then
+		// RotateY(-y), then RotateZ(-z).
+		static Quaternion FromEuler(const Vector3 &degrees) {
+			return
+				AxisAngle(Vector3(1, 0, 0), -ToRadians(degrees.X)) *
+				AxisAngle(Vector3(0, 1, 0), -ToRadians(degrees.Y)) *
+				AxisAngle(Vector3(0, 0, 1), -ToRadians(degrees.Z));
+		}
+
+		static Quaternion Normalize(const Quaternion &q) {
+			const float length = Sqrt(q.X * q.X + q.Y * q.Y + q.Z * q.Z + q.W * q.W);
+			return Quaternion(q.X / length, q.Y / length, q.Z / length, q.W / length);
+		}
+
 	public:
 		Quaternion(float x, float y, float z, float w) : X(x), Y(y), Z(z), W(w) { }
 		Quaternion() : X(0), Y(0), Z(0), W(1) { }
-		~Quaternion() { }
+		~Quaternion() = default;
+
+		// Rotating by the result is rotating by other first, then by this.
+		inline Quaternion operator*(const Quaternion &other) const {
+			return Quaternion(
+				W * other.X + X * other.W + Y * other.Z - Z * other.Y,
+				W * other.Y - X * other.Z + Y * other.W + Z * other.X,
+				W * other.Z + X * other.Y - Y * other.X + Z * other.W,
+				W * other.W - X * other.X - Y * other.Y - Z * other.Z
+			);
+		}
 
+		inline Vector3 Rotate(const Vector3 &v) const {
+			const Vector3 u(X, Y, Z);
+			const Vector3 t = Vector3::Cross(u, v) * 2.0f;
+			return v + t * W + Vector3::Cross(u, t);
+		}
+
+		// The inverse of FromEuler(), with the Y angle in [-90, 90].
 		inline Vector3 ToEuler() const {
-			const float w = ToRadians(W);
-			Vector3 rotation;
-			rotation.X = ToDegrees(std::atan2(
-				2 * (w * X + Y * Z),
-				1 - 2 * (X * X + Y * Y)
-			));
-
-			rotation.Y = ToDegrees(std::atan2(
-				std::sqrt(1 + 2 * (w * Y + X * Z)),
-				std::sqrt(1 - 2 * (w * Y + X * Z))
-			));
-
-			rotation.Z = ToDegrees(std::atan2(
-				2 * (w * Z + X * Y),
-				1 - 2 * (Y * Y + Z * Z)
-			));
-
-			return rotation;
+			const float r01 = 2 * (X * Y - Z * W);
+			const float r00 = 1 - 2 * (Y * Y + Z * Z);
+			const float r02 = 2 * (X * Z + Y * W);
+			const float r12 = 2 * (Y * Z - X * W);
+			const float r22 = 1 - 2 * (X * X + Y * Y);
+
+			return Vector3(
+				-ToDegrees(std::atan2(-r12, r22)),
+				-ToDegrees(std::asin(Clamp(r02, -1.0f, 1.0f))),
+				-ToDegrees(std::atan2(-r01, r00))
+			);
 		}
 
 	public:
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <Arcane/Core.hpp>
+
+// Vector4 and Matrix4 use SSE whenever the target has it, which every x64
+// target does. Define AR_MATH_SCALAR to build them with plain float code
+// instead, e.g. to compare results or on targets without SSE.
+#if !defined(AR_MATH_SCALAR) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#	define AR_MATH_SIMD 1
+#	include <immintrin.h>
+#else
+#	define AR_MATH_SIMD 0
+#endif
+
+// Fused multiply-add needs the compiler to target it (-mfma, /arch:AVX2);
+// without it a multiply and an add are used.
+#if AR_MATH_SIMD && (defined(__FMA__) || defined(__AVX2__))
+#	define AR_MATH_FMA 1
+#else
+#	define AR_MATH_FMA 0
+#endif
+
+// Functions marked AR_TARGET_AVX2 may use AVX2 and FMA intrinsics whatever
+// the compiler flags are, and must only be called when HasAVX2() is true.
+#if AR_MATH_SIMD && (defined(__GNUC__) || defined(__clang__))
+#	define AR_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#else
+#	define AR_TARGET_AVX2
+#endif
+
+#if AR_MATH_SIMD
+
+#define AR_SHUFFLE_MASK(x, y, z, w) ((x) | ((y) << 2) | ((z) << 4) | ((w) << 6))
+
+namespace Arcane {
+
+	// a * b + c
+	inline __m128 MulAdd(__m128 a, __m128 b, __m128 c) {
+#if AR_MATH_FMA
+		return _mm_fmadd_ps(a, b, c);
+#else
+		return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+	}
+
+	template<int _X, int _Y, int _Z, int _W>
+	inline __m128 Swizzle(__m128 v) {
+		return _mm_shuffle_ps(v, v, AR_SHUFFLE_MASK(_X, _Y, _Z, _W));
+	}
+
+	template<int _Index>
+	inline __m128 Splat(__m128 v) {
+		return _mm_shuffle_ps(v, v, AR_SHUFFLE_MASK(_Index, _Index, _Index, _Index));
+	}
+
+	// mask ? a : b, lane by lane, for masks from a comparison.
+	inline __m128 Select(__m128 mask, __m128 a, __m128 b) {
+		return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+	}
+
+	// The sum of all four lanes, in every lane.
+	inline __m128 HorizontalSum(__m128 v) {
+		const __m128 pairs = _mm_add_ps(v, Swizzle<1, 0, 3, 2>(v));
+		return _mm_add_ps(pairs, Swizzle<2, 3, 0, 1>(pairs));
+	}
+
+}
+
+#endif
\ No newline at end of file
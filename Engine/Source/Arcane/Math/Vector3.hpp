@@ -66,9 +66,9 @@ namespace Arcane {
 		Vector3(float x, const Vector2 &yz) : X(x), Y(yz.X), Z(yz.Y) { }
 		Vector3(float xyz) : X(xyz), Y(xyz), Z(xyz) { }
 		Vector3() : X(0), Y(0), Z(0) { }
-		Vector3(const Vector3& other) : X(other.X), Y(other.Y), Z(other.Z) { }
-		Vector3 &operator=(const Vector3 &other) { X = other.X; Y = other.Y; Z = other.Z; return *this; }
-		~Vector3() { }
+		Vector3(const Vector3 &other) = default;
+		Vector3 &operator=(const Vector3 &other) = default;
+		~Vector3() = default;
 
 		inline Vector3 operator+(const Vector3 &other) const { return Vector3(X + other.X, Y + other.Y, Z + other.Z); }
 		inline Vector3 operator-(const Vector3 &other) const { return Vector3(X - other.X, Y - other.Y, Z - other.Z); }
@@ -2,59 +2,70 @@
 
 #include <Arcane/Core.hpp>
 #include "Math.hpp"
+#include "SIMD.hpp"
 #include "Vector3.hpp"
 
 namespace Arcane {
 
-	class Vector4 {
+	class alignas(16) Vector4 {
 	public:
 		static Vector4 Zero() { return Vector4(0, 0, 0, 0); }
 		static Vector4 MaxValue() { return Vector4(__FLT_MAX__); }
 		static Vector4 MinValue() { return Vector4(-__FLT_MAX__); }
 
 		static Vector4 Min(const Vector4 &a, const Vector4 &b) {
+#if AR_MATH_SIMD
+			return Vector4(_mm_min_ps(a.Simd, b.Simd));
+#else
 			return Vector4(
 				Arcane::Min(a.X, b.X),
 				Arcane::Min(a.Y, b.Y),
 				Arcane::Min(a.Z, b.Z),
 				Arcane::Min(a.W, b.W)
 			);
+#endif
 		}
 
 		static Vector4 Max(const Vector4 &a, const Vector4 &b) {
+#if AR_MATH_SIMD
+			return Vector4(_mm_max_ps(a.Simd, b.Simd));
+#else
 			return Vector4(
 				Arcane::Max(a.X, b.X),
 				Arcane::Max(a.Y, b.Y),
 				Arcane::Max(a.Z, b.Z),
 				Arcane::Max(a.W, b.W)
 			);
+#endif
 		}
 
 		static Vector4 Abs(const Vector4 &v) {
+#if AR_MATH_SIMD
+			return Vector4(_mm_andnot_ps(_mm_set1_ps(-0.0f), v.Simd));
+#else
 			return Vector4(
 				Arcane::Abs(v.X),
 				Arcane::Abs(v.Y),
 				Arcane::Abs(v.Z),
 				Arcane::Abs(v.W)
 			);
+#endif
 		}
 
 		static float Length(const Vector4 &v) {
-			return Sqrt(v.X * v.X + v.Y * v.Y + v.Z * v.Z + v.W * v.W);
+			return Sqrt(Dot(v, v));
 		}
 
 		static float Dot(const Vector4 &a, const Vector4 &b) {
+#if AR_MATH_SIMD
+			return _mm_cvtss_f32(HorizontalSum(_mm_mul_ps(a.Simd, b.Simd)));
+#else
 			return a.X * b.X + a.Y * b.Y + a.Z * b.Z + a.W * b.W;
+#endif
 		}
 
 		static Vector4 Normalize(const Vector4 &v) {
-			const float length = Vector4::Length(v);
-			return Vector4(
-				v.X / length,
-				v.Y / length,
-				v.Z / length,
-				v.W / length
-			);
+			return v / Vector4::Length(v);
 		}
 
 	public:
@@ -63,10 +74,33 @@ namespace Arcane {
 		Vector4(float x, const Vector3 &yzw) : X(x), Y(yzw.X), Z(yzw.Y), W(yzw.Z) { }
 		Vector4(const Vector3 &xyz, float w) : X(xyz.X), Y(xyz.Y), Z(xyz.Z), W(w) { }
 		Vector4() : X(0), Y(0), Z(0), W(0) { }
-		Vector4(const Vector4& other) : X(other.X), Y(other.Y), Z(other.Z), W(other.W) { }
-		Vector4 &operator=(const Vector4 &other) { X = other.X; Y = other.Y; Z = other.Z; W = other.W; return *this; }
-		~Vector4() { }
-
+#if AR_MATH_SIMD
+		explicit Vector4(__m128 simd) : Simd(simd) { }
+#endif
+		Vector4(const Vector4 &other) = default;
+		Vector4 &operator=(const Vector4 &other) = default;
+		~Vector4() = default;
+
+#if AR_MATH_SIMD
+		inline Vector4 operator+(const Vector4 &other) const { return Vector4(_mm_add_ps(Simd, other.Simd)); }
+		inline Vector4 operator-(const Vector4 &other) const { return Vector4(_mm_sub_ps(Simd, other.Simd)); }
+		inline Vector4 operator*(float scalar) const { return Vector4(_mm_mul_ps(Simd, _mm_set1_ps(scalar))); }
+		inline Vector4 operator*(const Vector4 &other) const { return Vector4(_mm_mul_ps(Simd, other.Simd)); }
+		inline Vector4 operator/(float scalar) const { return Vector4(_mm_div_ps(Simd, _mm_set1_ps(scalar))); }
+		inline Vector4 operator/(const Vector4 &other) const { return Vector4(_mm_div_ps(Simd, other.Simd)); }
+
+		inline Vector4 &operator+=(const Vector4 &other) { Simd = _mm_add_ps(Simd, other.Simd); return *this; }
+		inline Vector4 &operator-=(const Vector4 &other) { Simd = _mm_sub_ps(Simd, other.Simd); return *this; }
+		inline Vector4 &operator*=(float scalar) { Simd = _mm_mul_ps(Simd, _mm_set1_ps(scalar)); return *this; }
+		inline Vector4 &operator*=(const Vector4 &other) { Simd = _mm_mul_ps(Simd, other.Simd); return *this; }
+		inline Vector4 &operator/=(float scalar) { Simd = _mm_div_ps(Simd, _mm_set1_ps(scalar)); return *this; }
+		inline Vector4 &operator/=(const Vector4 &other) { Simd = _mm_div_ps(Simd, other.Simd); return *this; }
+
+		inline Vector4 operator-() const { return Vector4(_mm_xor_ps(Simd, _mm_set1_ps(-0.0f))); }
+
+		inline bool operator==(const Vector4 &other) const { return _mm_movemask_ps(_mm_cmpeq_ps(Simd, other.Simd)) == 0xF; }
+		inline bool operator!=(const Vector4 &other) const { return !(*this == other); }
+#else
 		inline Vector4 operator+(const Vector4 &other) const { return Vector4(X + other.X, Y + other.Y, Z + other.Z, W + other.W); }
 		inline Vector4 operator-(const Vector4 &other) const { return Vector4(X - other.X, Y - other.Y, Z - other.Z, W - other.W); }
 		inline Vector4 operator*(float scalar) const { return Vector4(X * scalar, Y * scalar, Z * scalar, W * scalar); }
@@ -83,8 +117,9 @@ namespace Arcane {
 
 		inline Vector4 operator-() const { return Vector4(-X, -Y, -Z, -W); }
 
-		inline bool operator==(const Vector4 &other) { return X == other.X && Y == other.Y; }
-		inline bool operator!=(const Vector4 &other) { return X != other.X || Y != other.Y; }
+		inline bool operator==(const Vector4 &other) const { return X == other.X && Y == other.Y && Z == other.Z && W == other.W; }
+		inline bool operator!=(const Vector4 &other) const { return !(*this == other); }
+#endif
 
 		inline bool operator>(const Vector4 &other) { return Dot(*this, *this) > Dot(other, other); }
 		inline bool operator>=(const Vector4 &other) { return Dot(*this, *this) >= Dot(other, other); }
@@ -97,16 +132,16 @@ namespace Arcane {
 				float X, Y, Z, W;
 			};
 			float Data[4];
+#if AR_MATH_SIMD
+			__m128 Simd;
+#endif
 		};
 	};
 
+	static_assert(sizeof(Vector4) == 16, "Vector4 is uploaded to the GPU as a vec4");
+
 	inline Vector4 operator*(float scalar, const Vector4 &v) {
-		return Vector4(
-			scalar * v.X,
-			scalar * v.Y,
-			scalar * v.Z,
-			scalar * v.W
-		);
+		return v * scalar;
 	}
 
 }
\ No newline at end of file
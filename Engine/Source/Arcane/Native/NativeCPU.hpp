@@ -0,0 +1,42 @@
+#pragma once
+
+#include <Arcane/Core.hpp>
+#include <bitset>
+#include <vector>
+
+#define AR_MAX_CPUS 256
+
+namespace Arcane {
+
+	typedef std::bitset<AR_MAX_CPUS> CPUSet;
+
+	struct LogicalProcessor {
+		uint32_t Index;
+		uint32_t PhysicalCore;
+		uint32_t SMTIndex;
+		uint32_t Package;
+		uint32_t NUMANode;
+		uint32_t L3Group;
+	};
+
+	struct PhysicalCore {
+		uint32_t Index;
+		uint32_t Package;
+		uint32_t NUMANode;
+		uint32_t L3Group;
+		CPUSet Processors;
+		uint32_t ProcessorCount;
+	};
+
+	struct CPUTopology {
+		std::vector<LogicalProcessor> LogicalProcessors;
+		std::vector<PhysicalCore> PhysicalCores;
+		uint32_t PackageCount;
+		uint32_t NUMANodeCount;
+		uint32_t L3GroupCount;
+	};
+
+	// Fills in LogicalProcessors; every field except SMTIndex must be set.
+	void _QueryCPUTopology(CPUTopology &topology);
+
+}
\ No newline at end of file
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <Arcane/Core.hpp>
+
+#define AR_INVALID_FILE_HANDLE ((::Arcane::FileHandle)-1)
+
+namespace Arcane {
+
+	enum FileAccessHints {
+		FileAccessHint_None = 0,
+		FileAccessHint_Sequential = AR_BIT(0),
+		FileAccessHint_Random = AR_BIT(1),
+		FileAccessHint_WillNeed = AR_BIT(2)
+	};
+
+	// Maps a whole file read-only and stores its size in `size`. Returns
+	// nullptr if the file cannot be opened or is empty.
+	void *_MapFile(const char *path, uint32_t hints, size_t *size);
+	void _UnmapFile(void *ptr, size_t size);
+
+	typedef intptr_t FileHandle;
+
+	// Opens a file for reading and stores its size in `size`. Returns
+	// AR_INVALID_FILE_HANDLE if it cannot be opened.
+	FileHandle _OpenFile(const char *path, size_t *size);
+	void _CloseFile(FileHandle file);
+	// Blocking read at `offset` that leaves the file position alone, so it
+	// can be called from several threads at once. Returns the number of
+	// bytes read, or -1 on failure.
+	int64_t _ReadFileAt(FileHandle file, void *buffer, size_t size, uint64_t offset);
+
+	struct IOCompletion {
+		void *UserData;
+		// Bytes transferred, or a negative error code.
+		int64_t Result;
+	};
+
+	// Kernel submission queue for file reads. _CreateIORing() returns
+	// nullptr where there is none, in which case callers fall back to
+	// _ReadFileAt() on their own threads. Queueing and submitting must
+	// happen on one thread, waiting for completions on one other thread.
+	void *_CreateIORing(uint32_t depth);
+	void _DestroyIORing(void *ring);
+	// Returns false if the submission queue is full.
+	bool _QueueRead(void *ring, FileHandle file, void *buffer, size_t size, uint64_t offset, void *userData);
+	// Queues a no-op whose completion has a null UserData, to wake a
+	// thread blocked in _WaitIORing().
+	bool _QueueWake(void *ring);
+	void _SubmitIORing(void *ring);
+	// Blocks until at least one operation has completed and returns how
+	// many were stored in `completions`.
+	uint32_t _WaitIORing(void *ring, IOCompletion *completions, uint32_t max);
+
+	typedef void(*DirectoryChangeFunc)(uint32_t directory, const char *name, void *userData);
+
+	// Reports files that are written or moved into watched directories.
+	// Subdirectories are not watched. A watcher must only be used from
+	// one thread.
+	void *_CreateDirectoryWatcher();
+	void _DestroyDirectoryWatcher(void *watcher);
+	// Returns UINT32_MAX if the directory cannot be watched.
+	uint32_t _WatchDirectory(void *watcher, const char *path);
+	// Waits up to `millis` for changes and calls `func` once per event with
+	// the directory handle and the file name. Returns false on timeout.
+	bool _ReadDirectoryChanges(void *watcher, uint32_t millis, DirectoryChangeFunc func, void *userData);
+
+}
\ No newline at end of file
@@ -53,6 +53,10 @@ namespace Arcane {
 		virtual ~NativeGraphicsContext() { }
 
 		virtual void Present() = 0;
+		// Binds or unbinds the context on the calling thread, for APIs whose
+		// contexts belong to a thread.
+		virtual void MakeCurrent() = 0;
+		virtual void ReleaseCurrent() = 0;
 		
 		virtual uint32_t GetVersionMajor() const = 0;
 		virtual uint32_t GetVersionMinor() const = 0;
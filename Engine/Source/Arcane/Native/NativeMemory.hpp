@@ -12,4 +12,15 @@ namespace Arcane {
 	void *_MoveMemory(void *dest, void *src, size_t size);
 	void *_SetMemory(void *ptr, int value, size_t size);
 
+	enum VirtualMemoryFlags {
+		VirtualMemoryFlag_None = 0,
+		VirtualMemoryFlag_HugePages = AR_BIT(0)
+	};
+
+	size_t _GetPageSize();
+	void *_ReserveVirtual(size_t size, uint32_t flags);
+	void _ReleaseVirtual(void *ptr, size_t size);
+	void _CommitVirtual(void *ptr, size_t size);
+	void _DecommitVirtual(void *ptr, size_t size);
+
 }
\ No newline at end of file
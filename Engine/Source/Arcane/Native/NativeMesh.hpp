@@ -20,7 +20,7 @@ namespace Arcane {
 		virtual Ref<NativeBuffer> GetVertexBuffer(uint32_t index) = 0;
 		virtual Ref<NativeBuffer> GetIndexBuffer() = 0;
 
-		virtual InputLayout GetLayout() const = 0;
+		virtual const InputLayout &GetLayout() const = 0;
 
 		virtual void Destroy() = 0;
 		virtual bool IsValid() const = 0;
@@ -17,6 +17,10 @@
 #include <Platform/Windows/WindowsThread.hpp>
 #endif
 
+#ifdef __linux__
+#include <Platform/Linux/LinuxThread.hpp>
+#endif
+
 #include <Platform/OpenGL/OpenGLBuffer.hpp>
 #include <Platform/OpenGL/OpenGLFramebuffer.hpp>
 #include <Platform/OpenGL/OpenGLGraphicsContext.hpp>
@@ -47,18 +51,44 @@ namespace Arcane {
 	}
 
 	Ref<NativeMutex> NativeMutex::Create() {
-#ifdef _WIN32
+#if defined(_WIN32)
 		return CastRef<NativeMutex>(CreateRef<WindowsMutex>());
+#elif defined(__linux__)
+		return CastRef<NativeMutex>(CreateRef<LinuxMutex>());
 #else
 		return Ref<NativeMutex>::Invalid();
 #endif
 	}
 
+	Ref<NativeConditionVariable> NativeConditionVariable::Create() {
+#if defined(_WIN32)
+		return CastRef<NativeConditionVariable>(CreateRef<WindowsConditionVariable>());
+#elif defined(__linux__)
+		return CastRef<NativeConditionVariable>(CreateRef<LinuxConditionVariable>());
+#else
+		return Ref<NativeConditionVariable>::Invalid();
+#endif
+	}
+
+	Ref<NativeSemaphore> NativeSemaphore::Create(uint32_t count) {
+#if defined(_WIN32)
+		return CastRef<NativeSemaphore>(CreateRef<WindowsSemaphore>(count));
+#elif defined(__linux__)
+		return CastRef<NativeSemaphore>(CreateRef<LinuxSemaphore>(count));
+#else
+		return Ref<NativeSemaphore>::Invalid();
+#endif
+	}
+
 	Ref<NativeThread> NativeThread::Create(ThreadFunc func, void *data) {
-#ifdef _WIN32
+#if defined(_WIN32)
 		return CastRef<NativeThread>(CreateRef<WindowsThread>(
 			func, data
 		));
+#elif defined(__linux__)
+		return CastRef<NativeThread>(CreateRef<LinuxThread>(
+			func, data
+		));
 #else
 		return Ref<NativeThread>::Invalid();
 #endif
@@ -127,7 +127,7 @@ namespace Arcane {
 		virtual WindingOrder GetWindingOrder() const = 0;
 		virtual FillMode GetFillMode() const = 0;
 		virtual PrimitiveTopology GetTopology() const = 0;
-		virtual InputLayout GetLayout() const = 0;
+		virtual const InputLayout &GetLayout() const = 0;
 		virtual Rect2D GetViewport() const = 0;
 		virtual Rect2D GetScissor() const = 0;
 		virtual float GetPolygonOffsetFactor() const = 0;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Arcane/Core.hpp>
+#include "NativeCPU.hpp"
 
 namespace Arcane {
 
@@ -19,6 +20,33 @@ namespace Arcane {
 		virtual void Unlock() = 0;
 	};
 
+	class NativeConditionVariable {
+	public:
+		static Ref<NativeConditionVariable> Create();
+
+	public:
+		NativeConditionVariable() = default;
+		virtual ~NativeConditionVariable() = default;
+
+		virtual void Wait(const Ref<NativeMutex> &mutex) = 0;
+		virtual bool Wait(const Ref<NativeMutex> &mutex, uint32_t millis) = 0;
+		virtual void NotifyOne() = 0;
+		virtual void NotifyAll() = 0;
+	};
+
+	class NativeSemaphore {
+	public:
+		static Ref<NativeSemaphore> Create(uint32_t count);
+
+	public:
+		NativeSemaphore() = default;
+		virtual ~NativeSemaphore() = default;
+
+		virtual void Wait() = 0;
+		virtual bool TryWait() = 0;
+		virtual void Post(uint32_t count) = 0;
+	};
+
 	class NativeThread {
 	public:
 		static Ref<NativeThread> Create(ThreadFunc func, void *data);
@@ -36,6 +64,7 @@ namespace Arcane {
 		virtual void Start() = 0;
 		virtual void Suspend() = 0;
 		virtual void Terminate(int32_t code) = 0;
+		virtual void SetAffinity(const CPUSet &cpus) = 0;
 		virtual int32_t GetExitCode() const = 0;
 		virtual ThreadID GetID() const = 0;
 	};
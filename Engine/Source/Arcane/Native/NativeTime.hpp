@@ -5,5 +5,6 @@
 namespace Arcane {
 
 	uint64_t _GetCurrentTimeMillis();
+	uint64_t _GetCurrentTimeMicros();
 
 }
\ No newline at end of file
@@ -1,110 +1,194 @@
 #pragma once
 
 #include "Log.hpp"
+#include "System/PoolAllocator.hpp"
+#include <atomic>
+#include <memory>
+#include <new>
+#include <type_traits>
 
 namespace Arcane {
 
-	template<typename _Type>
+	// Shared header of every reference counted object. Destroy() runs once
+	// the count drops to zero and frees both the object and the block.
 	struct RefBlock {
-		RefBlock() { }
-		~RefBlock() { }
+		std::atomic<uint32_t> Count;
+		void (*Destroy)(RefBlock *block);
+	};
+
+	// Object and count in a single pool allocation, made by CreateRef().
+	template<typename _Type>
+	struct RefObject : public RefBlock {
+		alignas(_Type) uint8_t Storage[sizeof(_Type)];
+
+		inline _Type *GetPointer() { return std::launder(reinterpret_cast<_Type*>(Storage)); }
 
+		static void DestroyObject(RefBlock *block) {
+			RefObject<_Type> *object = static_cast<RefObject<_Type>*>(block);
+			std::destroy_at(object->GetPointer());
+			PoolDelete(object);
+		}
+	};
+
+	// Count for an object that was allocated on its own and handed to a Ref.
+	template<typename _Type>
+	struct RefPointerBlock : public RefBlock {
 		_Type *Pointer;
-		uint32_t Count;
+
+		static void DestroyObject(RefBlock *block) {
+			RefPointerBlock<_Type> *pointerBlock = static_cast<RefPointerBlock<_Type>*>(block);
+			delete pointerBlock->Pointer;
+			PoolDelete(pointerBlock);
+		}
+	};
+
+	// Base class for objects that carry their own reference count. A Ref
+	// can be made from a raw pointer to such an object at any time, e.g.
+	// from `this`, and will share the count with every other Ref to it.
+	class RefCounted : private RefBlock {
+	public:
+		RefCounted() { InitRefBlock(); }
+		RefCounted(const RefCounted &other) { InitRefBlock(); }
+		virtual ~RefCounted() = default;
+
+		RefCounted &operator=(const RefCounted &other) { return *this; }
+
+		inline uint32_t GetRefCount() const { return Count.load(std::memory_order_relaxed); }
+
+	private:
+		inline void InitRefBlock() {
+			Count.store(0, std::memory_order_relaxed);
+			Destroy = [](RefBlock *block) { delete static_cast<RefCounted*>(block); };
+		}
+
+		inline RefBlock *GetRefBlock() { return this; }
+
+		template<typename _Type>
+		friend class Ref;
 	};
 
+	// Thread-safe shared handle. Copies increment the count with relaxed
+	// ordering; the last release synchronizes with all earlier ones before
+	// destroying the object. Constness is shallow, as with raw pointers, so
+	// getters can hand out const references to their Ref members.
 	template<typename _Type>
 	class Ref {
 	public:
 		static Ref<_Type> Invalid() { return Ref<_Type>(); }
-		
+
 	public:
 		Ref() { }
 
-		Ref(RefBlock<_Type> *block) : mBlock(block) {
-			mBlock->Count++;
+		explicit Ref(_Type *pointer) : mPointer(pointer) {
+			if (pointer == nullptr) return;
+
+			if constexpr (std::is_base_of_v<RefCounted, _Type>) {
+				mBlock = static_cast<RefCounted*>(pointer)->GetRefBlock();
+				mBlock->Count.fetch_add(1, std::memory_order_relaxed);
+			} else {
+				RefPointerBlock<_Type> *block = PoolNew<RefPointerBlock<_Type>>();
+				block->Count.store(1, std::memory_order_relaxed);
+				block->Destroy = RefPointerBlock<_Type>::DestroyObject;
+				block->Pointer = pointer;
+				mBlock = block;
+			}
 		}
 
-		Ref(_Type *ptr) {
-			mBlock = new RefBlock<_Type>();
-			mBlock->Pointer = ptr;
-			mBlock->Count = 1;
+		// Shares the count of `block` for a pointer into the object it owns.
+		Ref(RefBlock *block, _Type *pointer) : mBlock(block), mPointer(pointer) {
+			if (mBlock != nullptr) mBlock->Count.fetch_add(1, std::memory_order_relaxed);
 		}
 
-		Ref(const Ref<_Type> &other) : mBlock(other.mBlock) {
-			if (mBlock == nullptr) return;
-			mBlock->Count++;
+		Ref(const Ref<_Type> &other) : Ref(other.mBlock, other.mPointer) { }
+
+		Ref(Ref<_Type> &&other) noexcept : mBlock(other.mBlock), mPointer(other.mPointer) {
+			other.mBlock = nullptr;
+			other.mPointer = nullptr;
 		}
 
+		template<typename _Other, typename = std::enable_if_t<std::is_convertible_v<_Other*, _Type*>>>
+		Ref(const Ref<_Other> &other) : Ref(other.GetRefBlock(), other.GetPointerUnchecked()) { }
+
 		~Ref() {
-			if (!mBlock) return;
-			mBlock->Count--;
-			if (mBlock->Count == 0) {
-				delete mBlock->Pointer;
-				delete mBlock;
-			}
+			Release(mBlock);
 		}
 
-		inline _Type *GetPointer() {
+		inline _Type *GetPointer() const {
 			AR_ASSERT(mBlock, "Reference Block is nullptr");
-			return mBlock->Pointer; 
-		}
-		const _Type *GetPointer() const {
-			AR_ASSERT(mBlock, "Reference Block is nullptr");
-			return mBlock->Pointer;
+			return mPointer;
 		}
 
-		inline RefBlock<_Type> *GetRefBlock() { return mBlock; }
-		inline const RefBlock<_Type> *GetRefBlock() const { return mBlock; }
+		// Null for invalid references instead of asserting.
+		inline _Type *GetPointerUnchecked() const { return mPointer; }
 
-		_Type *operator->() { return GetPointer(); }
-		const _Type *operator->() const { return GetPointer(); }
-		_Type &operator*() { return *GetPointer(); }
-		const _Type &operator*() const { return *GetPointer(); }
+		inline RefBlock *GetRefBlock() const { return mBlock; }
+		inline uint32_t GetRefCount() const { return mBlock ? mBlock->Count.load(std::memory_order_relaxed) : 0; }
 
-		Ref<_Type> &operator=(const Ref<_Type> &other) {
-			if (mBlock != nullptr) {
-				mBlock->Count--;
-				if (mBlock->Count == 0) {
-					delete mBlock->Pointer;
-					delete mBlock;
-				}
-			}
+		inline _Type *operator->() const { return GetPointer(); }
+		inline _Type &operator*() const { return *GetPointer(); }
 
+		Ref<_Type> &operator=(const Ref<_Type> &other) {
+			// Incrementing first keeps self-assignment safe.
+			if (other.mBlock != nullptr) other.mBlock->Count.fetch_add(1, std::memory_order_relaxed);
+			Release(mBlock);
 			mBlock = other.mBlock;
-			mBlock->Count++;
+			mPointer = other.mPointer;
 
 			return *this;
 		}
 
-		inline void Drop() {
-			if (mBlock == nullptr) return;
-			mBlock->Count--;
+		Ref<_Type> &operator=(Ref<_Type> &&other) noexcept {
+			if (this == &other) return *this;
+
+			Release(mBlock);
+			mBlock = other.mBlock;
+			mPointer = other.mPointer;
+			other.mBlock = nullptr;
+			other.mPointer = nullptr;
 
-			if (mBlock->Count != 0) return;
-			
-			delete mBlock->Pointer;
-			delete mBlock;
+			return *this;
+		}
 
+		inline void Drop() {
+			Release(mBlock);
 			mBlock = nullptr;
+			mPointer = nullptr;
 		}
 
-		inline bool IsValid() const { return mBlock != nullptr && mBlock->Pointer != nullptr; }
+		inline bool IsValid() const { return mBlock != nullptr && mPointer != nullptr; }
 		operator bool() const { return IsValid(); }
 
+	private:
+		static inline void Release(RefBlock *block) {
+			if (block == nullptr) return;
+			if (block->Count.fetch_sub(1, std::memory_order_release) != 1) return;
+
+			std::atomic_thread_fence(std::memory_order_acquire);
+			block->Destroy(block);
+		}
 
 	private:
-		RefBlock<_Type> *mBlock = nullptr; 
+		RefBlock *mBlock = nullptr;
+		_Type *mPointer = nullptr;
 	};
 
 	template<typename _RefType, typename ..._Args>
 	static Ref<_RefType> CreateRef(_Args &&...args) {
-		return Ref<_RefType>(new _RefType(std::forward<_Args>(args)...));
+		if constexpr (std::is_base_of_v<RefCounted, _RefType>) {
+			return Ref<_RefType>(new _RefType(std::forward<_Args>(args)...));
+		} else {
+			RefObject<_RefType> *object = PoolNew<RefObject<_RefType>>();
+			_RefType *pointer = new (object->Storage) _RefType(std::forward<_Args>(args)...);
+			object->Count.store(0, std::memory_order_relaxed);
+			object->Destroy = RefObject<_RefType>::DestroyObject;
+			return Ref<_RefType>(object, pointer);
+		}
 	}
 
+	// Unchecked cast between related types; the result shares the count.
 	template<typename _CastType, typename _RefType>
 	static Ref<_CastType> CastRef(const Ref<_RefType> &ref) {
-		return Ref<_CastType>((RefBlock<_CastType>*)ref.GetRefBlock());
+		return Ref<_CastType>(ref.GetRefBlock(), (_CastType*)ref.GetPointerUnchecked());
 	}
 
 }
\ No newline at end of file
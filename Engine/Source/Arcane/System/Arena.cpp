@@ -0,0 +1,106 @@
+#include "Arena.hpp"
+
+#include "Memory.hpp"
+#include <Arcane/Math/Math.hpp>
+
+namespace Arcane {
+
+	LinearArena::LinearArena(size_t blockSize) : mBlockSize(blockSize), mBlock(0), mOffset(0) { }
+
+	LinearArena::~LinearArena() {
+		for (const Block &block : mBlocks) {
+			Free(block.Data);
+		}
+	}
+
+	void *LinearArena::AllocateSlow(size_t size, size_t alignment) {
+		AR_ASSERT(alignment > 0 && (alignment & (alignment - 1)) == 0, "Alignment must be a power of two");
+
+		// Move on to the next block that fits, reusing blocks left behind
+		// by an earlier Rewind() or Reset().
+		for (mBlock = (mBlock < mBlocks.size()) ? mBlock + 1 : mBlock; mBlock < mBlocks.size(); mBlock++) {
+			const Block &block = mBlocks[mBlock];
+			const size_t offset = AlignOffset(block.Data, 0, alignment);
+			if (offset + size <= block.Size) {
+				mOffset = offset + size;
+				return block.Data + offset;
+			}
+		}
+
+		Block block;
+		block.Size = Max(mBlockSize, size + alignment);
+		block.Data = (uint8_t*)Arcane::Allocate(block.Size, MemoryTag::Arena);
+		mBlocks.push_back(block);
+		mBlock = mBlocks.size() - 1;
+
+		const size_t offset = AlignOffset(block.Data, 0, alignment);
+		mOffset = offset + size;
+		return block.Data + offset;
+	}
+
+	size_t LinearArena::GetUsedSize() const {
+		size_t used = 0;
+		for (size_t i = 0; i < mBlock && i < mBlocks.size(); i++) used += mBlocks[i].Size;
+		return used + mOffset;
+	}
+
+	size_t LinearArena::GetCapacity() const {
+		size_t capacity = 0;
+		for (const Block &block : mBlocks) capacity += block.Size;
+		return capacity;
+	}
+
+	LinearArena &GetThreadScratch() {
+		static thread_local LinearArena scratch;
+		return scratch;
+	}
+
+	FrameArena::FrameArena(size_t blockSize) : mCurrent(0), mPeakUsedSize(0), mFrameStartHeapAllocations(0), mFrameHeapAllocations(0), mHeapFreeFrames(0) {
+		for (LinearArena &arena : mArenas) {
+			arena.SetBlockSize(blockSize);
+		}
+	}
+
+	void FrameArena::Advance() {
+		mPeakUsedSize = Max(mPeakUsedSize, mArenas[mCurrent].GetUsedSize());
+
+		const uint64_t heapAllocations = GetHeapAllocationCount();
+		mFrameHeapAllocations = heapAllocations - mFrameStartHeapAllocations;
+		mFrameStartHeapAllocations = heapAllocations;
+		mHeapFreeFrames = (mFrameHeapAllocations == 0) ? mHeapFreeFrames + 1 : 0;
+
+		AR_PROFILE_PLOT("Frame arena used (KB)", (int64_t)(mArenas[mCurrent].GetUsedSize() / 1024));
+		AR_PROFILE_PLOT("Frame arena heap allocations", (int64_t)mFrameHeapAllocations);
+
+		mCurrent = (mCurrent + 1) % AR_FRAME_ARENA_COUNT;
+		mArenas[mCurrent].Reset();
+	}
+
+	FrameArenaStats FrameArena::GetStats() const {
+		FrameArenaStats stats;
+		stats.UsedSize = mArenas[mCurrent].GetUsedSize();
+		stats.PeakUsedSize = Max(mPeakUsedSize, stats.UsedSize);
+		stats.Capacity = 0;
+		for (const LinearArena &arena : mArenas) {
+			stats.Capacity += arena.GetCapacity();
+		}
+		stats.HeapAllocations = GetHeapAllocationCount();
+		stats.FrameHeapAllocations = mFrameHeapAllocations;
+		stats.HeapFreeFrames = mHeapFreeFrames;
+		return stats;
+	}
+
+	uint64_t FrameArena::GetHeapAllocationCount() const {
+		uint64_t count = 0;
+		for (const LinearArena &arena : mArenas) {
+			count += arena.GetHeapAllocationCount();
+		}
+		return count;
+	}
+
+	FrameArena &GetFrameArena() {
+		static FrameArena arena;
+		return arena;
+	}
+
+}
\ No newline at end of file
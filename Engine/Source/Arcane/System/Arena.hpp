@@ -0,0 +1,203 @@
+#pragma once
+
+#include <Arcane/Core.hpp>
+#include <cstddef>
+#include <vector>
+#include <string>
+#include <type_traits>
+
+#define AR_SCRATCH_BLOCK_SIZE (256 * 1024)
+#define AR_FRAME_ARENA_BLOCK_SIZE (1024 * 1024)
+#define AR_FRAME_ARENA_COUNT 3
+
+namespace Arcane {
+
+	struct ArenaMarker {
+		size_t Block;
+		size_t Offset;
+	};
+
+	// Bump allocator over a list of blocks. Memory is never freed one
+	// allocation at a time; the arena is rewound to a marker or reset as a
+	// whole, and its blocks are kept for reuse.
+	class LinearArena {
+	public:
+		LinearArena(size_t blockSize = AR_SCRATCH_BLOCK_SIZE);
+		~LinearArena();
+
+		LinearArena(const LinearArena &) = delete;
+		LinearArena &operator=(const LinearArena &) = delete;
+
+		inline void *Allocate(size_t size, size_t alignment = alignof(std::max_align_t)) {
+			if (mBlock < mBlocks.size()) {
+				const Block &block = mBlocks[mBlock];
+				const size_t offset = AlignOffset(block.Data, mOffset, alignment);
+				if (offset + size <= block.Size) {
+					mOffset = offset + size;
+					return block.Data + offset;
+				}
+			}
+
+			return AllocateSlow(size, alignment);
+		}
+
+		template<typename _Type>
+		inline _Type *AllocateArray(size_t count) { return (_Type*)Allocate(count * sizeof(_Type), alignof(_Type)); }
+
+		inline ArenaMarker GetMarker() const { return { mBlock, mOffset }; }
+		inline void Rewind(const ArenaMarker &marker) { mBlock = marker.Block; mOffset = marker.Offset; }
+		inline void Reset() { mBlock = 0; mOffset = 0; }
+
+		// Only affects blocks allocated from now on.
+		inline void SetBlockSize(size_t blockSize) { mBlockSize = blockSize; }
+
+		size_t GetUsedSize() const;
+		size_t GetCapacity() const;
+		// Number of blocks taken from the heap over the arena's lifetime.
+		inline uint64_t GetHeapAllocationCount() const { return mBlocks.size(); }
+
+	private:
+		struct Block {
+			uint8_t *Data;
+			size_t Size;
+		};
+
+		void *AllocateSlow(size_t size, size_t alignment);
+
+		static inline size_t AlignOffset(const uint8_t *data, size_t offset, size_t alignment) {
+			const uintptr_t address = (uintptr_t)data + offset;
+			return offset + (((address + alignment - 1) & ~(uintptr_t)(alignment - 1)) - address);
+		}
+
+	private:
+		std::vector<Block> mBlocks;
+		size_t mBlockSize;
+		size_t mBlock;
+		size_t mOffset;
+	};
+
+	// Scratch memory owned by the calling thread. Each job runs inside its
+	// own ScratchScope, and the main thread's scratch is reset every frame,
+	// so nothing allocated here may outlive the job or frame.
+	LinearArena &GetThreadScratch();
+
+	class ScratchScope {
+	public:
+		ScratchScope() : mArena(GetThreadScratch()), mMarker(mArena.GetMarker()) { }
+		~ScratchScope() { mArena.Rewind(mMarker); }
+
+		ScratchScope(const ScratchScope &) = delete;
+		ScratchScope &operator=(const ScratchScope &) = delete;
+
+	private:
+		LinearArena &mArena;
+		ArenaMarker mMarker;
+	};
+
+	struct FrameArenaStats {
+		size_t UsedSize;
+		size_t PeakUsedSize;
+		size_t Capacity;
+		uint64_t HeapAllocations;
+		// Blocks taken from the heap during the last finished frame. Stays
+		// at 0 once the arenas have grown to the steady-state frame size.
+		uint64_t FrameHeapAllocations;
+		uint64_t HeapFreeFrames;
+	};
+
+	// AR_FRAME_ARENA_COUNT linear arenas used round-robin, one per frame.
+	// Memory allocated during a frame stays valid for the two frames after
+	// it, which covers the frames the render thread may still be reading.
+	// Only the main thread may allocate from it.
+	class FrameArena {
+	public:
+		FrameArena(size_t blockSize = AR_FRAME_ARENA_BLOCK_SIZE);
+		~FrameArena() = default;
+
+		FrameArena(const FrameArena &) = delete;
+		FrameArena &operator=(const FrameArena &) = delete;
+
+		inline void *Allocate(size_t size, size_t alignment = alignof(std::max_align_t)) { return mArenas[mCurrent].Allocate(size, alignment); }
+
+		template<typename _Type>
+		inline _Type *AllocateArray(size_t count) { return mArenas[mCurrent].AllocateArray<_Type>(count); }
+
+		// Called once at the end of every frame. Resets the arena that the
+		// next frame will allocate from.
+		void Advance();
+
+		inline LinearArena &GetCurrent() { return mArenas[mCurrent]; }
+		FrameArenaStats GetStats() const;
+
+	private:
+		uint64_t GetHeapAllocationCount() const;
+
+	private:
+		LinearArena mArenas[AR_FRAME_ARENA_COUNT];
+		uint32_t mCurrent;
+		size_t mPeakUsedSize;
+		uint64_t mFrameStartHeapAllocations;
+		uint64_t mFrameHeapAllocations;
+		uint64_t mHeapFreeFrames;
+	};
+
+	FrameArena &GetFrameArena();
+
+	// STL allocator over a LinearArena. Deallocation is a no-op; memory is
+	// reclaimed when the arena is rewound or reset, so containers using it
+	// must not outlive that.
+	template<typename _Type>
+	class ArenaAllocator {
+	public:
+		typedef _Type value_type;
+		typedef std::true_type propagate_on_container_copy_assignment;
+		typedef std::true_type propagate_on_container_move_assignment;
+		typedef std::true_type propagate_on_container_swap;
+
+		ArenaAllocator(LinearArena &arena) : mArena(&arena) { }
+		template<typename _Other>
+		ArenaAllocator(const ArenaAllocator<_Other> &other) : mArena(other.GetArena()) { }
+
+		inline _Type *allocate(size_t count) { return mArena->AllocateArray<_Type>(count); }
+		inline void deallocate(_Type *pointer, size_t count) { }
+
+		inline LinearArena *GetArena() const { return mArena; }
+
+		template<typename _Other>
+		inline bool operator==(const ArenaAllocator<_Other> &other) const { return mArena == other.GetArena(); }
+		template<typename _Other>
+		inline bool operator!=(const ArenaAllocator<_Other> &other) const { return mArena != other.GetArena(); }
+
+	private:
+		LinearArena *mArena;
+	};
+
+	// STL allocator over the frame arena. Allocations always come from the
+	// current frame, so a container that is cleared and refilled every
+	// frame must be reassigned rather than cleared, or it would keep
+	// storage from an older frame.
+	template<typename _Type>
+	class FrameAllocator {
+	public:
+		typedef _Type value_type;
+		typedef std::true_type is_always_equal;
+		typedef std::true_type propagate_on_container_move_assignment;
+
+		FrameAllocator() = default;
+		template<typename _Other>
+		FrameAllocator(const FrameAllocator<_Other> &other) { }
+
+		inline _Type *allocate(size_t count) { return GetFrameArena().AllocateArray<_Type>(count); }
+		inline void deallocate(_Type *pointer, size_t count) { }
+
+		template<typename _Other>
+		inline bool operator==(const FrameAllocator<_Other> &other) const { return true; }
+		template<typename _Other>
+		inline bool operator!=(const FrameAllocator<_Other> &other) const { return false; }
+	};
+
+	template<typename _Type>
+	using FrameVector = std::vector<_Type, FrameAllocator<_Type>>;
+	using FrameString = std::basic_string<char, std::char_traits<char>, FrameAllocator<char>>;
+
+}
\ No newline at end of file
@@ -0,0 +1,246 @@
+#include "AsyncFileIO.hpp"
+
+#include "ThreadPool.hpp"
+
+namespace Arcane {
+
+	static AsyncFileIO *sAsyncFileIO = nullptr;
+
+	AsyncFileIO::AsyncFileIO() : mRunning(true), mRing(nullptr), mFreeReads(AR_ASYNC_IO_MAX_READS), mPendingReads(AR_ASYNC_IO_MAX_READS) {
+		mReads = new FileRead[AR_ASYNC_IO_MAX_READS];
+		for (uint32_t i = 0; i < AR_ASYNC_IO_MAX_READS; i++) {
+			mReads[i].Owner = this;
+			mFreeReads.Push(i);
+		}
+
+		mReadsAvailable = Semaphore::Create(0);
+		mRing = _CreateIORing(AR_ASYNC_IO_RING_DEPTH);
+
+		if (mRing) {
+			mRingSlots = Semaphore::Create(AR_ASYNC_IO_RING_DEPTH);
+
+			mSubmitThread = Thread::Create(SubmitMain, this);
+			mCompleteThread = Thread::Create(CompleteMain, this);
+			mSubmitThread.Start();
+			mCompleteThread.Start();
+			return;
+		}
+
+		for (uint32_t i = 0; i < AR_ASYNC_IO_FALLBACK_THREADS; i++) {
+			mFallbackThreads[i] = Thread::Create(FallbackMain, this);
+			mFallbackThreads[i].Start();
+		}
+	}
+
+	AsyncFileIO::~AsyncFileIO() {
+		mRunning.store(false, std::memory_order_release);
+
+		if (mRing) {
+			mReadsAvailable.Post();
+			Thread::Await(mSubmitThread);
+
+			// The submit thread is gone, so this thread may use the queue.
+			_QueueWake(mRing);
+			_SubmitIORing(mRing);
+			Thread::Await(mCompleteThread);
+
+			_DestroyIORing(mRing);
+		} else {
+			mReadsAvailable.Post(AR_ASYNC_IO_FALLBACK_THREADS);
+			for (uint32_t i = 0; i < AR_ASYNC_IO_FALLBACK_THREADS; i++) {
+				Thread::Await(mFallbackThreads[i]);
+			}
+		}
+
+		delete[] mReads;
+	}
+
+	FileHandle AsyncFileIO::Open(const std::string &path, size_t *size) {
+		size_t fileSize = 0;
+		const FileHandle file = _OpenFile(path.c_str(), &fileSize);
+		AR_ASSERT(file != AR_INVALID_FILE_HANDLE, "Could not open file: {}", path);
+
+		if (size) *size = fileSize;
+		return file;
+	}
+
+	void AsyncFileIO::Close(FileHandle file) {
+		_CloseFile(file);
+	}
+
+	FileReadID AsyncFileIO::Read(const FileReadRequest &request) {
+		AR_ASSERT(request.File != AR_INVALID_FILE_HANDLE, "Cannot read from an invalid file");
+		AR_ASSERT(request.Buffer != nullptr || request.Size == 0, "Read buffer cannot be null");
+
+		uint32_t index;
+		if (!mFreeReads.Pop(index)) {
+			AR_ASSERT(false, "More than {} reads are waiting to be awaited", AR_ASYNC_IO_MAX_READS);
+			return 0;
+		}
+
+		FileRead &read = mReads[index];
+		const FileReadID id = (read.ID & 0xFFFF0000) + 0x10000 + index;
+		read.ID = id;
+		read.Request = request;
+		read.Result = {};
+		read.State.store(FileReadState::Pending, std::memory_order_release);
+
+		// Cannot fail: the queue holds every read there is.
+		mPendingReads.Push(index);
+		mReadsAvailable.Post();
+		return id;
+	}
+
+	bool AsyncFileIO::IsComplete(FileReadID id) const {
+		const FileRead &read = mReads[id & 0xFFFF];
+		AR_ASSERT(read.ID == id && read.State.load() != FileReadState::Free, "Read {} has already been awaited", id);
+		return read.State.load(std::memory_order_acquire) == FileReadState::Completed;
+	}
+
+	FileReadResult AsyncFileIO::Await(FileReadID id) {
+		FileRead &read = mReads[id & 0xFFFF];
+		AR_ASSERT(read.ID == id && read.State.load() != FileReadState::Free, "Read {} has already been awaited", id);
+		AR_ASSERT(read.Request.Callback == nullptr, "Reads with a callback cannot be awaited");
+
+		// Like ThreadPool::AwaitTask(), other work keeps going meanwhile.
+		ThreadPool *pool = HasThreadPool() ? &GetThreadPool() : nullptr;
+		while (read.State.load(std::memory_order_acquire) != FileReadState::Completed) {
+			if (!(pool && pool->RunPendingTask())) Thread::Switch();
+		}
+
+		const FileReadResult result = read.Result;
+		Release(read);
+		return result;
+	}
+
+	void AsyncFileIO::Complete(FileRead &read, int64_t result) {
+		FileReadResult readResult;
+		readResult.Success = result >= 0;
+		readResult.Size = result >= 0 ? (size_t)result : 0;
+
+		if (read.Request.Callback && read.Request.CallbackThread == FileReadCallbackThread::ThreadPool && HasThreadPool()) {
+			// The read is kept until the task has taken its result.
+			read.Result = readResult;
+			read.State.store(FileReadState::Completed, std::memory_order_release);
+			GetThreadPool().AddDetachedTask(RunCallbackTask, &read, read.Request.CallbackPriority, "File read callback");
+			return;
+		}
+
+		if (read.Request.Callback) {
+			// Released first, so the callback can issue the next read.
+			const FileReadCallback callback = read.Request.Callback;
+			void *userData = read.Request.UserData;
+			Release(read);
+
+			callback(readResult, userData);
+			return;
+		}
+
+		read.Result = readResult;
+		read.State.store(FileReadState::Completed, std::memory_order_release);
+	}
+
+	void *AsyncFileIO::RunCallbackTask(void *data) {
+		FileRead &read = *(FileRead*)data;
+		const FileReadResult result = read.Result;
+		const FileReadCallback callback = read.Request.Callback;
+		void *userData = read.Request.UserData;
+		read.Owner->Release(read);
+
+		callback(result, userData);
+		return nullptr;
+	}
+
+	void AsyncFileIO::Release(FileRead &read) {
+		read.State.store(FileReadState::Free, std::memory_order_relaxed);
+		mFreeReads.Push(read.ID & 0xFFFF);
+	}
+
+	// Takes everything that is pending and hands it to the kernel in one
+	// submission, only blocking once the ring is full.
+	int32_t AsyncFileIO::SubmitMain(void *data) {
+		AsyncFileIO *io = (AsyncFileIO*)data;
+		AR_PROFILE_THREAD_NAME("IO Submit");
+
+		while (true) {
+			io->mReadsAvailable.Wait();
+			if (!io->mRunning.load(std::memory_order_acquire)) break;
+
+			uint32_t index;
+			while (io->mPendingReads.Pop(index)) {
+				if (!io->mRingSlots.TryWait()) {
+					_SubmitIORing(io->mRing);
+					io->mRingSlots.Wait();
+				}
+
+				FileRead &read = io->mReads[index];
+				[[maybe_unused]] const bool queued = _QueueRead(io->mRing, read.Request.File, read.Request.Buffer, read.Request.Size, read.Request.Offset, &read);
+				AR_ASSERT(queued, "IO ring is full");
+			}
+
+			_SubmitIORing(io->mRing);
+		}
+
+		return 0;
+	}
+
+	int32_t AsyncFileIO::CompleteMain(void *data) {
+		AsyncFileIO *io = (AsyncFileIO*)data;
+		AR_PROFILE_THREAD_NAME("IO Complete");
+
+		IOCompletion completions[64];
+		while (true) {
+			const uint32_t count = _WaitIORing(io->mRing, completions, 64);
+
+			bool stop = false;
+			for (uint32_t i = 0; i < count; i++) {
+				// The wake-up from the destructor is the only null entry.
+				if (completions[i].UserData == nullptr) {
+					stop = true;
+					continue;
+				}
+
+				io->Complete(*(FileRead*)completions[i].UserData, completions[i].Result);
+				io->mRingSlots.Post();
+			}
+
+			if (stop) break;
+		}
+
+		return 0;
+	}
+
+	int32_t AsyncFileIO::FallbackMain(void *data) {
+		AsyncFileIO *io = (AsyncFileIO*)data;
+		AR_PROFILE_THREAD_NAME("IO Worker");
+
+		while (true) {
+			io->mReadsAvailable.Wait();
+			if (!io->mRunning.load(std::memory_order_acquire)) break;
+
+			uint32_t index;
+			if (!io->mPendingReads.Pop(index)) continue;
+
+			FileRead &read = io->mReads[index];
+			io->Complete(read, _ReadFileAt(read.Request.File, read.Request.Buffer, read.Request.Size, read.Request.Offset));
+		}
+
+		return 0;
+	}
+
+	void InitAsyncFileIO() {
+		AR_ASSERT(!sAsyncFileIO, "Async file IO is already initialized");
+		sAsyncFileIO = new AsyncFileIO();
+	}
+
+	void ShutdownAsyncFileIO() {
+		delete sAsyncFileIO;
+		sAsyncFileIO = nullptr;
+	}
+
+	AsyncFileIO &GetAsyncFileIO() {
+		AR_ASSERT(sAsyncFileIO, "Async file IO is not initialized");
+		return *sAsyncFileIO;
+	}
+
+}
\ No newline at end of file
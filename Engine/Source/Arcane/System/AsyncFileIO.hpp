@@ -0,0 +1,164 @@
+#pragma once
+
+#include <Arcane/Core.hpp>
+#include <Arcane/Data/Queue.hpp>
+#include <Arcane/Native/NativeFile.hpp>
+#include "Thread.hpp"
+#include "ThreadPool.hpp"
+#include <coroutine>
+
+#define AR_ASYNC_IO_MAX_READS 1024
+#define AR_ASYNC_IO_RING_DEPTH 256
+#define AR_ASYNC_IO_FALLBACK_THREADS 4
+
+namespace Arcane {
+
+	typedef uint32_t FileReadID;
+
+	struct FileReadResult {
+		// Less than requested if the read ran into the end of the file.
+		size_t Size;
+		bool Success;
+	};
+
+	// Runs on the thread picked by the request's CallbackThread.
+	typedef void(*FileReadCallback)(const FileReadResult &result, void *userData);
+
+	enum class FileReadCallbackThread : uint32_t {
+		// The callback should only hand the data on, since it holds up
+		// other reads.
+		IO = 0,
+		// The callback runs as a detached thread pool task, so it can do
+		// the work the data was read for. Runs on an I/O thread when there
+		// is no thread pool.
+		ThreadPool
+	};
+
+	struct FileReadRequest {
+		FileHandle File;
+		// Owned by the caller and must stay valid until the read completes.
+		void *Buffer;
+		size_t Size;
+		uint64_t Offset;
+		// Reads with a callback release themselves and must not be awaited.
+		FileReadCallback Callback = nullptr;
+		void *UserData = nullptr;
+		FileReadCallbackThread CallbackThread = FileReadCallbackThread::IO;
+		TaskPriority CallbackPriority = TaskPriority::Normal;
+	};
+
+	enum class FileReadState : uint32_t {
+		Free = 0, Pending, Completed
+	};
+
+	class AsyncFileIO;
+
+	struct FileRead {
+		FileRead() : Owner(nullptr), ID(0), Request{}, Result{}, State(FileReadState::Free) { }
+
+		AsyncFileIO *Owner;
+		// Low 16 bits index the read storage, the rest is a generation that
+		// catches stale IDs.
+		FileReadID ID;
+		FileReadRequest Request;
+		FileReadResult Result;
+		std::atomic<FileReadState> State;
+	};
+
+	// Reads files into caller-provided buffers without blocking the caller.
+	// On Linux, reads queued close together go to io_uring in a single
+	// submission and complete in whatever order the device finishes them.
+	// Elsewhere, or without kernel support, a few threads serve them with
+	// blocking positioned reads, which still lets reads overlap.
+	//
+	// Every read without a callback must be awaited; that is what returns
+	// its storage. All reads, and the thread pool tasks of their callbacks,
+	// must have completed before the service is destroyed.
+	class AsyncFileIO {
+	public:
+		AsyncFileIO();
+		~AsyncFileIO();
+
+		AsyncFileIO(const AsyncFileIO &) = delete;
+		AsyncFileIO &operator=(const AsyncFileIO &) = delete;
+
+		// Opening is synchronous; open a file once and issue many reads.
+		static FileHandle Open(const std::string &path, size_t *size = nullptr);
+		static void Close(FileHandle file);
+
+		FileReadID Read(const FileReadRequest &request);
+		bool IsComplete(FileReadID id) const;
+		// Runs thread pool tasks while waiting, if there is a thread pool.
+		FileReadResult Await(FileReadID id);
+
+		inline bool IsUsingIORing() const { return mRing != nullptr; }
+
+	private:
+		static int32_t SubmitMain(void *data);
+		static int32_t CompleteMain(void *data);
+		static int32_t FallbackMain(void *data);
+		static void *RunCallbackTask(void *data);
+
+		void Complete(FileRead &read, int64_t result);
+		void Release(FileRead &read);
+
+	private:
+		std::atomic<bool> mRunning;
+		void *mRing;
+
+		FileRead *mReads;
+		MPMCQueue<uint32_t> mFreeReads;
+		MPMCQueue<uint32_t> mPendingReads;
+		Semaphore mReadsAvailable;
+		// Free submission slots, so the kernel's completion queue never
+		// holds more entries than it was sized for.
+		Semaphore mRingSlots;
+
+		Thread mSubmitThread;
+		Thread mCompleteThread;
+		Thread mFallbackThreads[AR_ASYNC_IO_FALLBACK_THREADS];
+	};
+
+	// co_await ReadAsync(io, request) suspends the coroutine until the read
+	// completes and yields its FileReadResult. The coroutine resumes on the
+	// thread picked by the request's CallbackThread.
+	class FileReadAwaitable {
+	public:
+		FileReadAwaitable(AsyncFileIO &io, const FileReadRequest &request) : mIO(io), mRequest(request), mResult{} { }
+
+		inline bool await_ready() const { return false; }
+
+		inline void await_suspend(std::coroutine_handle<> handle) {
+			mHandle = handle;
+			mRequest.Callback = Resume;
+			mRequest.UserData = this;
+			// The coroutine may resume, and this object go away, before Read()
+			// returns, so nothing may touch it afterwards.
+			mIO.Read(mRequest);
+		}
+
+		inline FileReadResult await_resume() const { return mResult; }
+
+	private:
+		static void Resume(const FileReadResult &result, void *userData) {
+			FileReadAwaitable *awaitable = (FileReadAwaitable*)userData;
+			awaitable->mResult = result;
+			awaitable->mHandle.resume();
+		}
+
+	private:
+		AsyncFileIO &mIO;
+		FileReadRequest mRequest;
+		FileReadResult mResult;
+		std::coroutine_handle<> mHandle;
+	};
+
+	inline FileReadAwaitable ReadAsync(AsyncFileIO &io, const FileReadRequest &request) {
+		return FileReadAwaitable(io, request);
+	}
+
+	void InitAsyncFileIO();
+	void ShutdownAsyncFileIO();
+	AsyncFileIO &GetAsyncFileIO();
+
+}
\ No newline at end of file
@@ -0,0 +1,154 @@
+#include "CPU.hpp"
+
+#include <Arcane/Math/Math.hpp>
+#include <algorithm>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#	include <intrin.h>
+#endif
+
+namespace Arcane {
+
+	static CPUSet sReservedCores;
+	static uint32_t sRoleCores[(uint32_t)CoreRole::Count] = { UINT32_MAX, UINT32_MAX };
+	static SpinLock sReservedCoresLock;
+
+	static CPUTopology QueryCPUTopology() {
+		AR_PROFILE_FUNCTION();
+		CPUTopology topology{};
+		_QueryCPUTopology(topology);
+
+		if (topology.LogicalProcessors.empty()) {
+			topology.LogicalProcessors.push_back({ 0, 0, 0, 0, 0, 0 });
+		}
+
+		uint32_t coreCount = 0;
+		for (const LogicalProcessor &processor : topology.LogicalProcessors) {
+			coreCount = Max(coreCount, processor.PhysicalCore + 1);
+			topology.PackageCount = Max(topology.PackageCount, processor.Package + 1);
+			topology.NUMANodeCount = Max(topology.NUMANodeCount, processor.NUMANode + 1);
+			topology.L3GroupCount = Max(topology.L3GroupCount, processor.L3Group + 1);
+		}
+
+		topology.PhysicalCores.resize(coreCount);
+		for (uint32_t i = 0; i < coreCount; i++) {
+			topology.PhysicalCores[i].Index = i;
+			topology.PhysicalCores[i].ProcessorCount = 0;
+		}
+
+		for (LogicalProcessor &processor : topology.LogicalProcessors) {
+			PhysicalCore &core = topology.PhysicalCores[processor.PhysicalCore];
+			processor.SMTIndex = core.ProcessorCount++;
+			core.Package = processor.Package;
+			core.NUMANode = processor.NUMANode;
+			core.L3Group = processor.L3Group;
+			if (processor.Index < AR_MAX_CPUS) core.Processors.set(processor.Index);
+		}
+
+		AR_ENGINE_INFO(
+			"CPU topology: {} logical processors, {} physical cores, {} L3 groups, {} NUMA nodes, {} packages",
+			topology.LogicalProcessors.size(), topology.PhysicalCores.size(), topology.L3GroupCount, topology.NUMANodeCount, topology.PackageCount
+		);
+
+		return topology;
+	}
+
+	const CPUTopology &GetCPUTopology() {
+		static CPUTopology topology = QueryCPUTopology();
+		return topology;
+	}
+
+	CPUSet GetCoreCPUSet(uint32_t physicalCore) {
+		const CPUTopology &topology = GetCPUTopology();
+		AR_ASSERT(physicalCore < topology.PhysicalCores.size(), "Physical core {} does not exist", physicalCore);
+		return topology.PhysicalCores[physicalCore].Processors;
+	}
+
+	uint32_t ReserveCore() {
+		ScopedLock lock(sReservedCoresLock);
+
+		std::vector<uint32_t> cores = GetUnreservedCores();
+		if (cores.size() <= 1) return UINT32_MAX;
+
+		sReservedCores.set(cores.front());
+		return cores.front();
+	}
+
+	uint32_t ReserveCore(CoreRole role) {
+		AR_ASSERT(GetReservedCore(role) == UINT32_MAX, "A core is already reserved for role {}", (uint32_t)role);
+		const uint32_t core = ReserveCore();
+		sRoleCores[(uint32_t)role] = core;
+		return core;
+	}
+
+	uint32_t GetReservedCore(CoreRole role) {
+		return sRoleCores[(uint32_t)role];
+	}
+
+	bool IsCoreReserved(uint32_t physicalCore) {
+		return physicalCore < AR_MAX_CPUS && sReservedCores.test(physicalCore);
+	}
+
+	std::vector<uint32_t> GetUnreservedCores() {
+		const CPUTopology &topology = GetCPUTopology();
+
+		std::vector<uint32_t> cores;
+		cores.reserve(topology.PhysicalCores.size());
+		for (const PhysicalCore &core : topology.PhysicalCores) {
+			if (!IsCoreReserved(core.Index)) cores.push_back(core.Index);
+		}
+
+		// Keep cores that share a NUMA node and L3 cache next to each other
+		// so consecutive workers end up close together.
+		std::stable_sort(cores.begin(), cores.end(), [&topology](uint32_t a, uint32_t b) {
+			const PhysicalCore &coreA = topology.PhysicalCores[a];
+			const PhysicalCore &coreB = topology.PhysicalCores[b];
+			if (coreA.NUMANode != coreB.NUMANode) return coreA.NUMANode < coreB.NUMANode;
+			return coreA.L3Group < coreB.L3Group;
+		});
+
+		return cores;
+	}
+
+	CPUSet GetUnreservedCPUSet() {
+		CPUSet cpus;
+		for (uint32_t core : GetUnreservedCores()) cpus |= GetCoreCPUSet(core);
+		return cpus;
+	}
+
+	void PinThread(Thread thread, uint32_t physicalCore) {
+		thread.SetAffinity(GetCoreCPUSet(physicalCore));
+	}
+
+	void PinToReservedCore(Thread thread, CoreRole role) {
+		const uint32_t core = GetReservedCore(role);
+		if (core != UINT32_MAX) PinThread(thread, core);
+		else thread.SetAffinity(GetUnreservedCPUSet());
+	}
+
+	bool HasAVX2() {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+		static const bool supported = []() {
+			int info[4];
+			__cpuid(info, 1);
+			const bool fma = info[2] & (1 << 12);
+			const bool osxsave = info[2] & (1 << 27);
+			// The OS has to save the YMM registers on a context switch.
+			if (!fma || !osxsave || (_xgetbv(0) & 0x6) != 0x6) return false;
+
+			__cpuidex(info, 7, 0);
+			return (info[1] & (1 << 5)) != 0;
+		}();
+		return supported;
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+		static const bool supported = []() {
+			__builtin_cpu_init();
+			return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+		}();
+		return supported;
+#else
+		return false;
+#endif
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <Arcane/Core.hpp>
+#include <Arcane/Native/NativeCPU.hpp>
+#include "Thread.hpp"
+
+namespace Arcane {
+
+	const CPUTopology &GetCPUTopology();
+	CPUSet GetCoreCPUSet(uint32_t physicalCore);
+
+	// Threads with a core of their own. main() reserves these before the
+	// workers are created, so no worker is pinned to the same core.
+	enum class CoreRole : uint32_t {
+		Main = 0, Render, Count
+	};
+
+	// Takes a physical core out of the set used for worker threads. Returns
+	// UINT32_MAX when reserving would leave no core for the workers.
+	uint32_t ReserveCore();
+	uint32_t ReserveCore(CoreRole role);
+	// UINT32_MAX if no core was reserved for the role.
+	uint32_t GetReservedCore(CoreRole role);
+	bool IsCoreReserved(uint32_t physicalCore);
+	std::vector<uint32_t> GetUnreservedCores();
+	// Every logical processor of the unreserved cores.
+	CPUSet GetUnreservedCPUSet();
+
+	void PinThread(Thread thread, uint32_t physicalCore);
+	// Without a core for the role the thread is kept off the reserved
+	// cores instead. On Linux a new thread inherits the affinity of the
+	// thread that creates it, which may be pinned to a single core.
+	void PinToReservedCore(Thread thread, CoreRole role);
+
+	// Whether the CPU and OS support AVX2 together with FMA.
+	bool HasAVX2();
+
+}
\ No newline at end of file
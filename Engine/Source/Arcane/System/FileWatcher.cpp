@@ -0,0 +1,160 @@
+#include "FileWatcher.hpp"
+
+#include "Time.hpp"
+#include "Memory.hpp"
+#include <Arcane/Native/NativeFile.hpp>
+#include <algorithm>
+
+namespace Arcane {
+
+	static FileWatcher *sFileWatcher = nullptr;
+
+	FileWatcher::FileWatcher() : mRunning(true), mNextID(1) {
+		mLock = Mutex::Create();
+		mNativeWatcher = _CreateDirectoryWatcher();
+
+		mThread = Thread::Create(WatcherMain, this);
+		mThread.Start();
+	}
+
+	FileWatcher::~FileWatcher() {
+		mRunning.store(false, std::memory_order_release);
+		Thread::Await(mThread);
+
+		_DestroyDirectoryWatcher(mNativeWatcher);
+	}
+
+	FileWatchID FileWatcher::Watch(const std::filesystem::path &path, FileChangeCallback callback, void *userData) {
+		AR_ASSERT(callback != nullptr, "File watch callback cannot be null");
+
+		const std::filesystem::path absolute = std::filesystem::absolute(path).lexically_normal();
+		const std::filesystem::path directory = absolute.parent_path();
+
+		ScopedLock lock(mLock);
+
+		uint32_t directoryIndex = 0;
+		while (directoryIndex < mDirectories.size() && mDirectories[directoryIndex].Path != directory) directoryIndex++;
+
+		if (directoryIndex == mDirectories.size()) {
+			mDirectories.push_back({ directory, UINT32_MAX });
+			mNewDirectories.push_back(directoryIndex);
+		}
+
+		const FileWatchID id = mNextID++;
+		mWatches.push_back({ id, absolute, absolute.filename().string(), directoryIndex, callback, userData });
+		return id;
+	}
+
+	void FileWatcher::Unwatch(FileWatchID id) {
+		ScopedLock lock(mLock);
+
+		auto it = std::find_if(mWatches.begin(), mWatches.end(), [id](const FileWatch &watch) { return watch.ID == id; });
+		AR_ASSERT(it != mWatches.end(), "File watch {} does not exist", id);
+		if (it != mWatches.end()) mWatches.erase(it);
+	}
+
+	int32_t FileWatcher::WatcherMain(void *data) {
+		FileWatcher *watcher = (FileWatcher*)data;
+		AR_PROFILE_THREAD_NAME("File Watcher");
+		// Changes arrive at any time, never as part of a frame, so nothing
+		// this thread allocates counts against the steady-state check.
+		UncheckedAllocationScope unchecked;
+
+		while (watcher->mRunning.load(std::memory_order_acquire)) {
+			watcher->WatchNewDirectories();
+
+			// While changes are settling, wake up in time to deliver them.
+			const uint32_t timeout = watcher->mPending.empty() ? AR_FILE_WATCH_POLL_MILLIS : AR_FILE_WATCH_SETTLE_MILLIS;
+			_ReadDirectoryChanges(watcher->mNativeWatcher, timeout, OnDirectoryChange, watcher);
+
+			watcher->Dispatch(GetCurrentTimeMicros());
+		}
+
+		return 0;
+	}
+
+	void FileWatcher::OnDirectoryChange(uint32_t directory, const char *name, void *userData) {
+		FileWatcher *watcher = (FileWatcher*)userData;
+
+		uint32_t directoryIndex = UINT32_MAX;
+		{
+			ScopedLock lock(watcher->mLock);
+
+			for (uint32_t i = 0; i < watcher->mDirectories.size(); i++) {
+				if (watcher->mDirectories[i].Handle == directory) directoryIndex = i;
+			}
+
+			// Other files in a watched directory are of no interest.
+			auto watched = [&](const FileWatch &watch) { return watch.Directory == directoryIndex && watch.Name == name; };
+			if (std::none_of(watcher->mWatches.begin(), watcher->mWatches.end(), watched)) return;
+		}
+
+		const uint64_t now = GetCurrentTimeMicros();
+		for (PendingFileChange &change : watcher->mPending) {
+			if (change.Directory == directoryIndex && change.Name == name) {
+				change.LastEventMicros = now;
+				return;
+			}
+		}
+
+		watcher->mPending.push_back({ directoryIndex, name, now });
+	}
+
+	void FileWatcher::WatchNewDirectories() {
+		ScopedLock lock(mLock);
+
+		for (uint32_t index : mNewDirectories) {
+			WatchedDirectory &directory = mDirectories[index];
+			directory.Handle = _WatchDirectory(mNativeWatcher, directory.Path.string().c_str());
+		}
+
+		mNewDirectories.clear();
+	}
+
+	void FileWatcher::Dispatch(uint64_t now) {
+		for (size_t i = 0; i < mPending.size();) {
+			const PendingFileChange &change = mPending[i];
+			if (now - change.LastEventMicros < AR_FILE_WATCH_SETTLE_MILLIS * 1000) {
+				i++;
+				continue;
+			}
+
+			// Callbacks run without the lock, so they may watch or unwatch
+			// files themselves.
+			mDispatch.clear();
+			{
+				ScopedLock lock(mLock);
+				for (const FileWatch &watch : mWatches) {
+					if (watch.Directory == change.Directory && watch.Name == change.Name) mDispatch.push_back(watch);
+				}
+			}
+
+			for (const FileWatch &watch : mDispatch) {
+				AR_ENGINE_INFO("File changed: {}", watch.Path.string());
+				watch.Callback(watch.Path, watch.UserData);
+			}
+
+			mPending.erase(mPending.begin() + i);
+		}
+	}
+
+	void InitFileWatcher() {
+		AR_ASSERT(!sFileWatcher, "File watcher is already initialized");
+		sFileWatcher = new FileWatcher();
+	}
+
+	void ShutdownFileWatcher() {
+		delete sFileWatcher;
+		sFileWatcher = nullptr;
+	}
+
+	FileWatcher &GetFileWatcher() {
+		AR_ASSERT(sFileWatcher, "File watcher is not initialized");
+		return *sFileWatcher;
+	}
+
+	bool HasFileWatcher() {
+		return sFileWatcher != nullptr;
+	}
+
+}
\ No newline at end of file
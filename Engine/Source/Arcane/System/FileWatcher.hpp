@@ -0,0 +1,90 @@
+#pragma once
+
+#include <Arcane/Core.hpp>
+#include "Thread.hpp"
+#include <filesystem>
+#include <vector>
+
+// Changes to a file are held back until it has been quiet for this long,
+// so a save that writes a file in several steps is reported once.
+#define AR_FILE_WATCH_SETTLE_MILLIS 100
+// How often the watcher thread looks for new directories and shutdown.
+#define AR_FILE_WATCH_POLL_MILLIS 250
+
+namespace Arcane {
+
+	typedef uint32_t FileWatchID;
+
+	// Called on the watcher thread, so anything that touches the graphics
+	// context has to be handed to the thread that owns it.
+	typedef void(*FileChangeCallback)(const std::filesystem::path &path, void *userData);
+
+	struct FileWatch {
+		FileWatchID ID;
+		std::filesystem::path Path;
+		std::string Name;
+		// Index into the watcher's directories.
+		uint32_t Directory;
+		FileChangeCallback Callback;
+		void *UserData;
+	};
+
+	struct WatchedDirectory {
+		std::filesystem::path Path;
+		// UINT32_MAX until the watcher thread has registered it.
+		uint32_t Handle;
+	};
+
+	struct PendingFileChange {
+		uint32_t Directory;
+		std::string Name;
+		uint64_t LastEventMicros;
+	};
+
+	// Watches individual files for changes and notifies subscribers on its
+	// own thread. The directory of every file is watched rather than the
+	// file itself, so files that are replaced instead of rewritten are
+	// still seen.
+	class FileWatcher {
+	public:
+		FileWatcher();
+		~FileWatcher();
+
+		FileWatcher(const FileWatcher &) = delete;
+		FileWatcher &operator=(const FileWatcher &) = delete;
+
+		FileWatchID Watch(const std::filesystem::path &path, FileChangeCallback callback, void *userData = nullptr);
+		// A notification that is already being delivered may still arrive.
+		void Unwatch(FileWatchID id);
+
+	private:
+		static int32_t WatcherMain(void *data);
+		static void OnDirectoryChange(uint32_t directory, const char *name, void *userData);
+
+		void WatchNewDirectories();
+		void Dispatch(uint64_t now);
+
+	private:
+		std::atomic<bool> mRunning;
+		void *mNativeWatcher;
+		Thread mThread;
+
+		Mutex mLock;
+		std::vector<FileWatch> mWatches;
+		std::vector<WatchedDirectory> mDirectories;
+		// Directories added by Watch() that the watcher thread has not
+		// registered yet; the native watcher is only used on that thread.
+		std::vector<uint32_t> mNewDirectories;
+		FileWatchID mNextID;
+
+		// Only touched by the watcher thread.
+		std::vector<PendingFileChange> mPending;
+		std::vector<FileWatch> mDispatch;
+	};
+
+	void InitFileWatcher();
+	void ShutdownFileWatcher();
+	FileWatcher &GetFileWatcher();
+	bool HasFileWatcher();
+
+}
\ No newline at end of file
@@ -0,0 +1,240 @@
+#include "Memory.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace Arcane {
+
+	static const char *sMemoryTagNames[(size_t)MemoryTag::Count] = {
+		"General", "Renderer", "Assets", "ECS", "Network", "Physics", "Arena"
+	};
+
+	const char *GetMemoryTagName(MemoryTag tag) {
+		return tag < MemoryTag::Count ? sMemoryTagNames[(size_t)tag] : "Unknown";
+	}
+
+#if AR_MEMORY_TRACKING
+
+	// Stored in front of every tracked allocation. Its size keeps the
+	// returned pointer aligned like the native allocator's.
+	struct alignas(16) AllocationHeader {
+		size_t Size;
+		MemoryTag Tag;
+	};
+
+	struct alignas(AR_CACHE_LINE_SIZE) MemoryTagCounters {
+		std::atomic<size_t> CurrentSize;
+		std::atomic<size_t> PeakSize;
+		std::atomic<uint64_t> LiveAllocations;
+		std::atomic<uint64_t> TotalAllocations;
+		std::atomic<uint64_t> FrameAllocations;
+		std::atomic<uint64_t> LastFrameAllocations;
+	};
+
+	static MemoryTagCounters sCounters[(size_t)MemoryTag::Count];
+	static thread_local MemoryTag sCurrentTag = MemoryTag::General;
+
+	static std::atomic<uint64_t> sHeapAllocations;
+	static std::atomic<uint64_t> sCheckedHeapAllocations;
+	static std::atomic<uint64_t> sLastFrameHeapAllocations;
+	static thread_local uint32_t sUncheckedDepth = 0;
+
+	static bool sSteadyStateCheck = false;
+	static uint32_t sWarmupFrames = 0;
+
+	// Also called from the global operator new below, so it must not
+	// allocate itself.
+	static inline void CountHeapAllocation() {
+		sHeapAllocations.fetch_add(1, std::memory_order_relaxed);
+		if (sUncheckedDepth == 0) sCheckedHeapAllocations.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	static void TrackAllocation(MemoryTag tag, size_t size) {
+		MemoryTagCounters &counters = sCounters[(size_t)tag];
+
+		const size_t current = counters.CurrentSize.fetch_add(size, std::memory_order_relaxed) + size;
+		size_t peak = counters.PeakSize.load(std::memory_order_relaxed);
+		while (current > peak && !counters.PeakSize.compare_exchange_weak(peak, current, std::memory_order_relaxed)) { }
+
+		counters.LiveAllocations.fetch_add(1, std::memory_order_relaxed);
+		counters.TotalAllocations.fetch_add(1, std::memory_order_relaxed);
+		counters.FrameAllocations.fetch_add(1, std::memory_order_relaxed);
+
+		CountHeapAllocation();
+	}
+
+	static void TrackFree(MemoryTag tag, size_t size) {
+		MemoryTagCounters &counters = sCounters[(size_t)tag];
+		counters.CurrentSize.fetch_sub(size, std::memory_order_relaxed);
+		counters.LiveAllocations.fetch_sub(1, std::memory_order_relaxed);
+	}
+
+	void *Allocate(size_t size) {
+		return Allocate(size, sCurrentTag);
+	}
+
+	void *Allocate(size_t size, MemoryTag tag) {
+		AllocationHeader *header = (AllocationHeader*)_Allocate(sizeof(AllocationHeader) + size);
+		header->Size = size;
+		header->Tag = tag;
+
+		TrackAllocation(tag, size);
+
+		void *ptr = header + 1;
+		AR_PROFILE_ALLOC_NAMED(ptr, size, sMemoryTagNames[(size_t)tag]);
+		return ptr;
+	}
+
+	void *ReAllocate(void *ptr, size_t size) {
+		if (ptr == nullptr) return Allocate(size);
+
+		AllocationHeader *header = (AllocationHeader*)ptr - 1;
+		const MemoryTag tag = header->Tag;
+
+		AR_PROFILE_FREE_NAMED(ptr, sMemoryTagNames[(size_t)tag]);
+		TrackFree(tag, header->Size);
+
+		header = (AllocationHeader*)_ReAllocate(header, sizeof(AllocationHeader) + size);
+		header->Size = size;
+
+		TrackAllocation(tag, size);
+
+		void *newPtr = header + 1;
+		AR_PROFILE_ALLOC_NAMED(newPtr, size, sMemoryTagNames[(size_t)tag]);
+		return newPtr;
+	}
+
+	void Free(void *ptr) {
+		AR_ASSERT(ptr != nullptr, "Cannot free null pointer");
+
+		AllocationHeader *header = (AllocationHeader*)ptr - 1;
+
+		AR_PROFILE_FREE_NAMED(ptr, sMemoryTagNames[(size_t)header->Tag]);
+		TrackFree(header->Tag, header->Size);
+
+		_Free(header);
+	}
+
+	MemoryTagStats GetMemoryTagStats(MemoryTag tag) {
+		const MemoryTagCounters &counters = sCounters[(size_t)tag];
+
+		MemoryTagStats stats;
+		stats.CurrentSize = counters.CurrentSize.load(std::memory_order_relaxed);
+		stats.PeakSize = counters.PeakSize.load(std::memory_order_relaxed);
+		stats.LiveAllocations = counters.LiveAllocations.load(std::memory_order_relaxed);
+		stats.TotalAllocations = counters.TotalAllocations.load(std::memory_order_relaxed);
+		stats.FrameAllocations = counters.LastFrameAllocations.load(std::memory_order_relaxed);
+		return stats;
+	}
+
+	void AdvanceMemoryFrame() {
+		for (size_t i = 0; i < (size_t)MemoryTag::Count; i++) {
+			MemoryTagCounters &counters = sCounters[i];
+			counters.LastFrameAllocations.store(counters.FrameAllocations.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+			AR_PROFILE_PLOT(sMemoryTagNames[i], (int64_t)counters.CurrentSize.load(std::memory_order_relaxed));
+		}
+
+		const uint64_t frameHeapAllocations = sCheckedHeapAllocations.exchange(0, std::memory_order_relaxed);
+		sLastFrameHeapAllocations.store(frameHeapAllocations, std::memory_order_relaxed);
+		AR_PROFILE_PLOT("Heap Allocations", (int64_t)frameHeapAllocations);
+
+		if (!sSteadyStateCheck) return;
+		if (sWarmupFrames > 0) {
+			sWarmupFrames--;
+			return;
+		}
+
+		if (frameHeapAllocations == 0) return;
+
+		// Allocate() calls are broken down by tag; the rest came from
+		// operator new.
+		UncheckedAllocationScope unchecked;
+		for (size_t i = 0; i < (size_t)MemoryTag::Count; i++) {
+			const uint64_t count = sCounters[i].LastFrameAllocations.load(std::memory_order_relaxed);
+			if (count > 0) AR_ENGINE_ERROR("Memory tag '{}' made {} allocations this frame", sMemoryTagNames[i], count);
+		}
+
+		AR_ASSERT(false, "Steady-state frame made {} heap allocations", frameHeapAllocations);
+	}
+
+	void ReportMemoryLeaks() {
+		for (size_t i = 0; i < (size_t)MemoryTag::Count; i++) {
+			const MemoryTagStats stats = GetMemoryTagStats((MemoryTag)i);
+			if (stats.LiveAllocations == 0) continue;
+
+			AR_ENGINE_WARNING("Memory tag '{}' has {} live allocations ({} bytes) at shutdown, peak was {} bytes", sMemoryTagNames[i], stats.LiveAllocations, stats.CurrentSize, stats.PeakSize);
+		}
+	}
+
+	MemoryTagScope::MemoryTagScope(MemoryTag tag) : mPrevious(sCurrentTag) {
+		sCurrentTag = tag;
+	}
+
+	MemoryTagScope::~MemoryTagScope() {
+		sCurrentTag = mPrevious;
+	}
+
+	uint64_t GetHeapAllocationCount() {
+		return sHeapAllocations.load(std::memory_order_relaxed);
+	}
+
+	uint64_t GetFrameHeapAllocationCount() {
+		return sLastFrameHeapAllocations.load(std::memory_order_relaxed);
+	}
+
+	void SetSteadyStateAllocationCheck(bool enabled, uint32_t warmupFrames) {
+		sSteadyStateCheck = enabled;
+		sWarmupFrames = warmupFrames;
+	}
+
+	UncheckedAllocationScope::UncheckedAllocationScope() {
+		sUncheckedDepth++;
+	}
+
+	UncheckedAllocationScope::~UncheckedAllocationScope() {
+		sUncheckedDepth--;
+	}
+
+	bool IsInUncheckedAllocationScope() {
+		return sUncheckedDepth > 0;
+	}
+
+#endif
+
+}
+
+#if AR_MEMORY_TRACKING
+
+// Replacements for the global allocation functions, so that containers,
+// strings and everything else built on operator new are counted as well.
+// Over-aligned new is left to the standard library.
+void *operator new(size_t size) {
+	Arcane::CountHeapAllocation();
+
+	void *ptr = std::malloc(size == 0 ? 1 : size);
+	if (ptr == nullptr) throw std::bad_alloc();
+	return ptr;
+}
+
+void *operator new[](size_t size) {
+	return operator new(size);
+}
+
+void *operator new(size_t size, const std::nothrow_t &) noexcept {
+	Arcane::CountHeapAllocation();
+	return std::malloc(size == 0 ? 1 : size);
+}
+
+void *operator new[](size_t size, const std::nothrow_t &) noexcept {
+	return operator new(size, std::nothrow);
+}
+
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+void operator delete[](void *ptr) noexcept { std::free(ptr); }
+void operator delete(void *ptr, size_t size) noexcept { std::free(ptr); }
+void operator delete[](void *ptr, size_t size) noexcept { std::free(ptr); }
+void operator delete(void *ptr, const std::nothrow_t &) noexcept { std::free(ptr); }
+void operator delete[](void *ptr, const std::nothrow_t &) noexcept { std::free(ptr); }
+
+#endif
\ No newline at end of file
@@ -2,24 +2,145 @@
 
 #include <Arcane/Core.hpp>
 #include <Arcane/Native/NativeMemory.hpp>
+#include <Arcane/System/PoolAllocator.hpp>
+
+#ifndef AR_MEMORY_TRACKING
+#	ifdef _DEBUG
+#		define AR_MEMORY_TRACKING 1
+#	else
+#		define AR_MEMORY_TRACKING 0
+#	endif
+#endif
+
+#define AR_STEADY_STATE_WARMUP_FRAMES 60
 
 namespace Arcane {
 
-	void *Allocate(size_t size) { return _Allocate(size); }
-	void *ReAllocate(void *ptr, size_t size) { return _ReAllocate(ptr, size); }
-	void Free(void *ptr) { _Free(ptr); }
+	enum class MemoryTag : uint8_t {
+		General = 0,
+		Renderer, Assets, ECS, Network, Physics, Arena,
+		Count
+	};
+
+	struct MemoryTagStats {
+		size_t CurrentSize;
+		size_t PeakSize;
+		uint64_t LiveAllocations;
+		uint64_t TotalAllocations;
+		// Allocations made during the last finished frame.
+		uint64_t FrameAllocations;
+	};
+
+	const char *GetMemoryTagName(MemoryTag tag);
+
+#if AR_MEMORY_TRACKING
+	// Allocations made through Allocate() are counted against a tag: the one
+	// passed in, or else the innermost MemoryTagScope on the calling thread.
+	// Memory must be released through Free() and never through _Free().
+	void *Allocate(size_t size);
+	void *Allocate(size_t size, MemoryTag tag);
+	void *ReAllocate(void *ptr, size_t size);
+	void Free(void *ptr);
+
+	MemoryTagStats GetMemoryTagStats(MemoryTag tag);
+	// Called once at the end of every frame.
+	void AdvanceMemoryFrame();
+	// Logs every tag that still has live allocations. Memory owned by
+	// globals, such as the frame arena, is only freed after main() returns
+	// and is reported as well.
+	void ReportMemoryLeaks();
+
+	// Heap allocations made on any thread through operator new or
+	// Allocate(). Over-aligned operator new is not counted.
+	uint64_t GetHeapAllocationCount();
+	// Heap allocations made during the last finished frame outside of an
+	// UncheckedAllocationScope.
+	uint64_t GetFrameHeapAllocationCount();
+	// Once enabled, every frame after the first `warmupFrames` is expected
+	// to make no heap allocations outside of an UncheckedAllocationScope,
+	// and AdvanceMemoryFrame() asserts on any frame that does.
+	void SetSteadyStateAllocationCheck(bool enabled, uint32_t warmupFrames = AR_STEADY_STATE_WARMUP_FRAMES);
+
+	class MemoryTagScope {
+	public:
+		MemoryTagScope(MemoryTag tag);
+		~MemoryTagScope();
+
+		MemoryTagScope(const MemoryTagScope &) = delete;
+		MemoryTagScope &operator=(const MemoryTagScope &) = delete;
+
+	private:
+		MemoryTag mPrevious;
+	};
+
+	// Allocations made by the calling thread while one is alive are left out
+	// of the steady-state check. Meant for work that only happens on
+	// demand, like reloading shaders or resizing framebuffers.
+	class UncheckedAllocationScope {
+	public:
+		UncheckedAllocationScope();
+		~UncheckedAllocationScope();
+
+		UncheckedAllocationScope(const UncheckedAllocationScope &) = delete;
+		UncheckedAllocationScope &operator=(const UncheckedAllocationScope &) = delete;
+	};
+
+	// Whether the calling thread is inside an UncheckedAllocationScope, so
+	// work it hands to other threads can be left out of the check as well.
+	bool IsInUncheckedAllocationScope();
+#else
+	inline void *Allocate(size_t size) { return _Allocate(size); }
+	inline void *Allocate(size_t size, MemoryTag tag) { return _Allocate(size); }
+	inline void *ReAllocate(void *ptr, size_t size) { return _ReAllocate(ptr, size); }
+	inline void Free(void *ptr) { _Free(ptr); }
+
+	inline MemoryTagStats GetMemoryTagStats(MemoryTag tag) { return {}; }
+	inline void AdvanceMemoryFrame() { }
+	inline void ReportMemoryLeaks() { }
+
+	inline uint64_t GetHeapAllocationCount() { return 0; }
+	inline uint64_t GetFrameHeapAllocationCount() { return 0; }
+	inline void SetSteadyStateAllocationCheck(bool enabled, uint32_t warmupFrames = AR_STEADY_STATE_WARMUP_FRAMES) { }
+
+	class MemoryTagScope {
+	public:
+		MemoryTagScope(MemoryTag tag) { }
+	};
+
+	class UncheckedAllocationScope {
+	public:
+		UncheckedAllocationScope() { }
+	};
+
+	inline bool IsInUncheckedAllocationScope() { return false; }
+#endif
 
 	template<typename _Type>
-	_Type *AllocateArray(size_t count) { return _Allocate(count * sizeof(_Type)); }
+	_Type *AllocateArray(size_t count) { return (_Type*)Allocate(count * sizeof(_Type)); }
 	template<typename _Type>
-	_Type *ReAllocateArray(_Type *ptr, size_t count) { return _ReAllocate(ptr, count * sizeof(_Type)); }
+	_Type *ReAllocateArray(_Type *ptr, size_t count) { return (_Type*)ReAllocate(ptr, count * sizeof(_Type)); }
 
+	// Objects come from the pool allocator and must be released with FreeObject().
 	template<typename _Type>
-	_Type *AllocateObject() { return (_Type*)_Allocate(sizeof(_Type)); }
+	_Type *AllocateObject() { return (_Type*)_SetMemory(PoolAllocate(sizeof(_Type)), 0, sizeof(_Type)); }
+	template<typename _Type>
+	void FreeObject(_Type *ptr) { PoolFree(ptr, sizeof(_Type)); }
+
+	inline void *CopyMemory(void *dest, const void *src, size_t size) { return _CopyMemory(dest, src, size); }
+	inline void *MoveMemory(void *dest, void *src, size_t size) { return _MoveMemory(dest, src, size); }
+	inline void *SetMemory(void *ptr, int value, size_t size) { return _SetMemory(ptr, value, size); }
+	inline void *ZeroMemory(void *ptr, size_t size) { return _SetMemory(ptr, 0, size); }
 
-	void *CopyMemory(void *dest, const void *src, size_t size) { return _CopyMemory(dest, src, size); }
-	void *MoveMemory(void *dest, void *src, size_t size) { return _MoveMemory(dest, src, size); }
-	void *SetMemory(void *ptr, int value, size_t size) { return _SetMemory(ptr, value, size); }
-	void *ZeroMemory(void *ptr, size_t size) { return _SetMemory(ptr, 0, size); }
+	// Reserved ranges only take up address space. Pages must be committed
+	// before they are touched and read as zero afterwards; decommitting
+	// returns the physical memory but keeps the range reserved, so data
+	// placed in it never has to move. Committing rounds the range out to
+	// whole pages, decommitting only affects pages that lie entirely inside
+	// it. Huge pages are a hint and may be ignored by the system.
+	inline size_t GetPageSize() { return _GetPageSize(); }
+	inline void *ReserveVirtual(size_t size, uint32_t flags = VirtualMemoryFlag_None) { return _ReserveVirtual(size, flags); }
+	inline void ReleaseVirtual(void *ptr, size_t size) { _ReleaseVirtual(ptr, size); }
+	inline void CommitVirtual(void *ptr, size_t size) { _CommitVirtual(ptr, size); }
+	inline void DecommitVirtual(void *ptr, size_t size) { _DecommitVirtual(ptr, size); }
 
 }
\ No newline at end of file
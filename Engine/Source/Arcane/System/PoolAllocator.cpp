@@ -0,0 +1,181 @@
+#include "PoolAllocator.hpp"
+
+#include <Arcane/Core.hpp>
+#include <Arcane/Native/NativeMemory.hpp>
+#include <mutex>
+
+namespace Arcane {
+
+	struct PoolNode {
+		PoolNode *Next;
+	};
+
+	struct PoolClass {
+		std::mutex Mutex;
+		PoolNode *Head = nullptr;
+		uint64_t SlabCount = 0;
+	};
+
+	// Trivially destructible so that frees which happen after the thread's
+	// destructors have run can still see that the cache is gone.
+	struct PoolThreadCache {
+		PoolNode *Heads[AR_POOL_SIZE_CLASS_COUNT];
+		uint32_t Counts[AR_POOL_SIZE_CLASS_COUNT];
+		bool Registered;
+		bool Destroyed;
+	};
+
+	struct PoolThreadCacheGuard {
+		~PoolThreadCacheGuard();
+	};
+
+	static PoolClass sClasses[AR_POOL_SIZE_CLASS_COUNT];
+	static thread_local PoolThreadCache sCache;
+
+	static inline uint32_t GetSizeClass(size_t size) {
+		return size == 0 ? 0 : (uint32_t)((size - 1) / AR_POOL_ALIGNMENT);
+	}
+
+	static inline size_t GetClassSize(uint32_t sizeClass) {
+		return (sizeClass + 1) * AR_POOL_ALIGNMENT;
+	}
+
+	static void RegisterThreadCache() {
+		static thread_local PoolThreadCacheGuard guard;
+		sCache.Registered = true;
+	}
+
+	// Moves up to `count` nodes from the front of a thread's list to the
+	// shared list of the class.
+	static void ReturnNodes(uint32_t sizeClass, uint32_t count) {
+		PoolNode *first = sCache.Heads[sizeClass];
+		if (first == nullptr) return;
+
+		PoolNode *last = first;
+		uint32_t moved = 1;
+		while (moved < count && last->Next != nullptr) {
+			last = last->Next;
+			moved++;
+		}
+
+		sCache.Heads[sizeClass] = last->Next;
+		sCache.Counts[sizeClass] -= moved;
+
+		PoolClass &poolClass = sClasses[sizeClass];
+		std::lock_guard<std::mutex> lock(poolClass.Mutex);
+		last->Next = poolClass.Head;
+		poolClass.Head = first;
+	}
+
+	PoolThreadCacheGuard::~PoolThreadCacheGuard() {
+		for (uint32_t i = 0; i < AR_POOL_SIZE_CLASS_COUNT; i++) {
+			ReturnNodes(i, UINT32_MAX);
+		}
+
+		sCache.Destroyed = true;
+	}
+
+	static PoolNode *AllocateSlab(PoolClass &poolClass, uint32_t sizeClass) {
+		const size_t size = GetClassSize(sizeClass);
+		const size_t count = AR_POOL_SLAB_SIZE / size;
+		uint8_t *slab = (uint8_t*)_Allocate(AR_POOL_SLAB_SIZE);
+
+		for (size_t i = 0; i < count - 1; i++) {
+			((PoolNode*)(slab + i * size))->Next = (PoolNode*)(slab + (i + 1) * size);
+		}
+		((PoolNode*)(slab + (count - 1) * size))->Next = nullptr;
+
+		poolClass.SlabCount++;
+		return (PoolNode*)slab;
+	}
+
+	static void *AllocateShared(uint32_t sizeClass) {
+		PoolClass &poolClass = sClasses[sizeClass];
+		std::lock_guard<std::mutex> lock(poolClass.Mutex);
+
+		if (poolClass.Head == nullptr) poolClass.Head = AllocateSlab(poolClass, sizeClass);
+
+		PoolNode *node = poolClass.Head;
+		poolClass.Head = node->Next;
+		return node;
+	}
+
+	static void *RefillThreadCache(uint32_t sizeClass) {
+		if (!sCache.Registered) RegisterThreadCache();
+
+		PoolClass &poolClass = sClasses[sizeClass];
+		std::lock_guard<std::mutex> lock(poolClass.Mutex);
+
+		if (poolClass.Head == nullptr) poolClass.Head = AllocateSlab(poolClass, sizeClass);
+
+		// Hand one node to the caller and move up to a batch into the cache.
+		PoolNode *node = poolClass.Head;
+		PoolNode *last = node;
+		uint32_t count = 0;
+		while (count < AR_POOL_BATCH_SIZE && last->Next != nullptr) {
+			last = last->Next;
+			count++;
+		}
+
+		sCache.Heads[sizeClass] = count > 0 ? node->Next : nullptr;
+		sCache.Counts[sizeClass] = count;
+		poolClass.Head = last->Next;
+		last->Next = nullptr;
+
+		return node;
+	}
+
+	void *PoolAllocate(size_t size) {
+		if (size > AR_POOL_MAX_SIZE) return _Allocate(size);
+
+		const uint32_t sizeClass = GetSizeClass(size);
+		if (sCache.Destroyed) return AllocateShared(sizeClass);
+
+		PoolNode *node = sCache.Heads[sizeClass];
+		if (node == nullptr) return RefillThreadCache(sizeClass);
+
+		sCache.Heads[sizeClass] = node->Next;
+		sCache.Counts[sizeClass]--;
+		return node;
+	}
+
+	void PoolFree(void *ptr, size_t size) {
+		if (ptr == nullptr) return;
+
+		if (size > AR_POOL_MAX_SIZE) {
+			_Free(ptr);
+			return;
+		}
+
+		const uint32_t sizeClass = GetSizeClass(size);
+		PoolNode *node = (PoolNode*)ptr;
+
+		if (sCache.Destroyed) {
+			PoolClass &poolClass = sClasses[sizeClass];
+			std::lock_guard<std::mutex> lock(poolClass.Mutex);
+			node->Next = poolClass.Head;
+			poolClass.Head = node;
+			return;
+		}
+
+		if (!sCache.Registered) RegisterThreadCache();
+
+		node->Next = sCache.Heads[sizeClass];
+		sCache.Heads[sizeClass] = node;
+
+		if (++sCache.Counts[sizeClass] > AR_POOL_BATCH_SIZE * 2) ReturnNodes(sizeClass, AR_POOL_BATCH_SIZE);
+	}
+
+	PoolStats GetPoolStats() {
+		PoolStats stats = {};
+
+		for (PoolClass &poolClass : sClasses) {
+			std::lock_guard<std::mutex> lock(poolClass.Mutex);
+			stats.SlabCount += poolClass.SlabCount;
+		}
+
+		stats.ReservedSize = stats.SlabCount * AR_POOL_SLAB_SIZE;
+		return stats;
+	}
+
+}
\ No newline at end of file
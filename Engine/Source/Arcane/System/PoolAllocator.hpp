@@ -0,0 +1,56 @@
+#pragma once
+
+// Included by Ref.hpp, so this header must not depend on Core.hpp.
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+
+#define AR_POOL_ALIGNMENT 16
+#define AR_POOL_MAX_SIZE 256
+#define AR_POOL_SIZE_CLASS_COUNT (AR_POOL_MAX_SIZE / AR_POOL_ALIGNMENT)
+#define AR_POOL_SLAB_SIZE (64 * 1024)
+#define AR_POOL_BATCH_SIZE 32
+
+namespace Arcane {
+
+	struct PoolStats {
+		uint64_t SlabCount;
+		uint64_t ReservedSize;
+	};
+
+	// Thread-safe allocator for small objects. Sizes are rounded up to a
+	// multiple of AR_POOL_ALIGNMENT and served from per-thread free lists,
+	// which exchange batches with a shared list per size class only when
+	// they run empty or grow too long. Memory is carved from slabs that are
+	// kept for the lifetime of the process. Larger sizes go to the heap.
+	void *PoolAllocate(size_t size);
+	// `size` must be the size that was passed to PoolAllocate().
+	void PoolFree(void *ptr, size_t size);
+
+	PoolStats GetPoolStats();
+
+	template<typename _Type, typename ..._Args>
+	_Type *PoolNew(_Args &&...args) {
+		if constexpr (alignof(_Type) > AR_POOL_ALIGNMENT) {
+			return new _Type(std::forward<_Args>(args)...);
+		} else {
+			return new (PoolAllocate(sizeof(_Type))) _Type(std::forward<_Args>(args)...);
+		}
+	}
+
+	// The object must be exactly a _Type, not a class derived from it.
+	template<typename _Type>
+	void PoolDelete(_Type *object) {
+		if (object == nullptr) return;
+
+		if constexpr (alignof(_Type) > AR_POOL_ALIGNMENT) {
+			delete object;
+		} else {
+			std::destroy_at(object);
+			PoolFree(object, sizeof(_Type));
+		}
+	}
+
+}
\ No newline at end of file
@@ -39,7 +39,7 @@ namespace Arcane {
 		
 		inline bool IsValid() const { return GetNativeSocket()->IsValid(); }
 
-		virtual Ref<NativeSocket> GetNativeSocket() const {
+		virtual const Ref<NativeSocket> &GetNativeSocket() const {
 			AR_ASSERT(mNativeSocket, "Native socket is nullptr");
 			return mNativeSocket;
 		}
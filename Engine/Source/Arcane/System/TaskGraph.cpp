@@ -0,0 +1,187 @@
+#include "TaskGraph.hpp"
+
+#include "PoolAllocator.hpp"
+#include "Memory.hpp"
+#include "Time.hpp"
+#include <Arcane/Math/Math.hpp>
+#include <algorithm>
+
+namespace Arcane {
+
+	TaskGraph::TaskGraph() : mPool(nullptr), mContextQueue(nullptr), mCompleted(0), mUncheckedAllocations(false), mStartMicros(0), mEndMicros(0) { }
+
+	TaskGraph::~TaskGraph() {
+		for (TaskGraphNode *node : mNodes) {
+			PoolDelete(node);
+		}
+	}
+
+	TaskGraphNodeID TaskGraph::AddTask(const std::string &name, TaskFunc func, void *data, std::initializer_list<TaskGraphNodeID> dependencies, TaskPriority priority) {
+		return AddNode(name, func, data, dependencies, priority, false);
+	}
+
+	TaskGraphNodeID TaskGraph::AddContextTask(const std::string &name, TaskFunc func, void *data, std::initializer_list<TaskGraphNodeID> dependencies) {
+		return AddNode(name, func, data, dependencies, TaskPriority::Critical, true);
+	}
+
+	void TaskGraph::AddDependency(TaskGraphNodeID node, TaskGraphNodeID dependency) {
+		AR_ASSERT(mPool == nullptr, "Dependencies cannot be added to a task graph that has been executed");
+		AR_ASSERT(dependency < node && node < mNodes.size(), "Task graph node '{}' depends on a node that was not added before it", mNodes[node]->Name);
+
+		mNodes[dependency]->Dependents.Push(node);
+		mNodes[node]->RemainingDependencies.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	TaskGraphNodeID TaskGraph::AddNode(const std::string &name, TaskFunc func, void *data, std::initializer_list<TaskGraphNodeID> dependencies, TaskPriority priority, bool contextThread) {
+		AR_ASSERT(mPool == nullptr, "Nodes cannot be added to a task graph that has been executed");
+		const TaskGraphNodeID id = (TaskGraphNodeID)mNodes.size();
+
+		TaskGraphNode *node = PoolNew<TaskGraphNode>();
+		node->Graph = this;
+		node->Name = name;
+		node->Func = func;
+		node->Data = data;
+		node->Priority = priority;
+		node->ContextThread = contextThread;
+		node->RemainingDependencies.store((uint32_t)dependencies.size(), std::memory_order_relaxed);
+		node->Task = 0;
+		node->StartMicros = 0;
+		node->EndMicros = 0;
+		node->Thread = 0;
+
+		for (TaskGraphNodeID dependency : dependencies) {
+			AR_ASSERT(dependency < id, "Task graph node '{}' depends on a node that was not added before it", name);
+			mNodes[dependency]->Dependents.Push(id);
+		}
+
+		mNodes.push_back(node);
+		return id;
+	}
+
+	void TaskGraph::Execute(ThreadPool &pool) {
+		AR_PROFILE_FUNCTION();
+		AR_ASSERT(mPool == nullptr, "A task graph can only be executed once");
+		mPool = &pool;
+		mUncheckedAllocations = IsInUncheckedAllocationScope();
+		mStartMicros = GetCurrentTimeMicros();
+
+		MPSCQueue<TaskGraphNode*> contextQueue(Max<size_t>(mNodes.size(), 2));
+		mContextQueue = &contextQueue;
+		mContextWake = Semaphore::Create(0);
+
+		// Roots are collected up front; once the first one is dispatched,
+		// workers start releasing other nodes concurrently.
+		std::vector<TaskGraphNode*> roots;
+		for (TaskGraphNode *node : mNodes) {
+			if (node->RemainingDependencies.load(std::memory_order_relaxed) == 0) roots.push_back(node);
+		}
+
+		for (TaskGraphNode *node : roots) {
+			Dispatch(node);
+		}
+
+		// Woken once per ready context node and once more when the last
+		// node finishes.
+		const uint32_t count = (uint32_t)mNodes.size();
+		while (mCompleted.load(std::memory_order_acquire) < count) {
+			mContextWake.Wait();
+
+			TaskGraphNode *node;
+			while (contextQueue.Pop(node)) {
+				AR_PROFILE_DYNAMIC_SCOPE(node->Name.c_str());
+				RunNode(node);
+			}
+		}
+
+		for (TaskGraphNode *node : mNodes) {
+			if (!node->ContextThread) pool.AwaitTask(node->Task);
+		}
+
+		mContextQueue = nullptr;
+		mEndMicros = GetCurrentTimeMicros();
+	}
+
+	void *TaskGraph::RunNodeTask(void *data) {
+		TaskGraphNode *node = (TaskGraphNode*)data;
+		node->Graph->RunNode(node);
+		return nullptr;
+	}
+
+	void TaskGraph::RunNode(TaskGraphNode *node) {
+		node->Thread = Thread::GetCurrent().GetID();
+		node->StartMicros = GetCurrentTimeMicros();
+		if (mUncheckedAllocations) {
+			UncheckedAllocationScope unchecked;
+			node->Func(node->Data);
+		} else {
+			node->Func(node->Data);
+		}
+		node->EndMicros = GetCurrentTimeMicros();
+
+		for (TaskGraphNodeID id : node->Dependents) {
+			TaskGraphNode *dependent = mNodes[id];
+			if (dependent->RemainingDependencies.fetch_sub(1, std::memory_order_acq_rel) == 1) Dispatch(dependent);
+		}
+
+		// Dispatching happens first so every task ID is stored by the time
+		// Execute() sees the last completion.
+		if (mCompleted.fetch_add(1, std::memory_order_acq_rel) + 1 == mNodes.size()) {
+			mContextWake.Post();
+		}
+	}
+
+	void TaskGraph::Dispatch(TaskGraphNode *node) {
+		if (node->ContextThread) {
+			[[maybe_unused]] const bool pushed = mContextQueue->Push(node);
+			AR_ASSERT(pushed, "Task graph context queue is full");
+			mContextWake.Post();
+			return;
+		}
+
+		node->Task = mPool->AddTask(RunNodeTask, node, node->Priority, node->Name.c_str());
+	}
+
+	uint64_t TaskGraph::GetCriticalPathMicros() const {
+		// Nodes are stored in dependency order, so one forward pass finds
+		// the longest chain ending at every node.
+		std::vector<uint64_t> longest(mNodes.size(), 0);
+		uint64_t critical = 0;
+
+		for (size_t i = 0; i < mNodes.size(); i++) {
+			const TaskGraphNode *node = mNodes[i];
+			longest[i] += node->EndMicros - node->StartMicros;
+			critical = Max(critical, longest[i]);
+
+			for (TaskGraphNodeID id : node->Dependents) {
+				longest[id] = Max(longest[id], longest[i]);
+			}
+		}
+
+		return critical;
+	}
+
+	void TaskGraph::LogTimings(const char *title) const {
+		uint64_t work = 0;
+		for (const TaskGraphNode *node : mNodes) {
+			work += node->EndMicros - node->StartMicros;
+		}
+
+		AR_ENGINE_INFO("{}: {:.2f} ms wall time, {:.2f} ms of work, {:.2f} ms critical path, {} jobs",
+			title, GetWallMicros() / 1000.0, work / 1000.0, GetCriticalPathMicros() / 1000.0, mNodes.size()
+		);
+
+		std::vector<const TaskGraphNode*> nodes(mNodes.begin(), mNodes.end());
+		std::sort(nodes.begin(), nodes.end(), [](const TaskGraphNode *a, const TaskGraphNode *b) { return a->StartMicros < b->StartMicros; });
+
+		for ([[maybe_unused]] const TaskGraphNode *node : nodes) {
+			AR_ENGINE_INFO("  {:8.2f} ms +{:8.2f} ms  {:<7} {:>6}  {}",
+				(node->StartMicros - mStartMicros) / 1000.0,
+				(node->EndMicros - node->StartMicros) / 1000.0,
+				node->ContextThread ? "context" : "worker",
+				node->Thread,
+				node->Name
+			);
+		}
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <Arcane/Core.hpp>
+#include "ThreadPool.hpp"
+#include <Arcane/Data/SmallVector.hpp>
+#include <initializer_list>
+#include <vector>
+#include <string>
+
+namespace Arcane {
+
+	typedef uint32_t TaskGraphNodeID;
+
+	class TaskGraph;
+
+	struct TaskGraphNode {
+		TaskGraph *Graph;
+		std::string Name;
+		TaskFunc Func;
+		void *Data;
+		TaskPriority Priority;
+		// Context nodes run on the thread that calls Execute(), which must
+		// own the graphics context. Everything else goes to the thread pool.
+		bool ContextThread;
+
+		SmallVector<TaskGraphNodeID, 4> Dependents;
+		std::atomic<uint32_t> RemainingDependencies;
+		TaskID Task;
+
+		uint64_t StartMicros;
+		uint64_t EndMicros;
+		ThreadID Thread;
+	};
+
+	// One-shot dependency graph of jobs, used to run engine startup and
+	// shader reloads in parallel. Dependencies must be added before the
+	// nodes that depend on them.
+	class TaskGraph {
+	public:
+		TaskGraph();
+		~TaskGraph();
+
+		TaskGraph(const TaskGraph &) = delete;
+		TaskGraph &operator=(const TaskGraph &) = delete;
+
+		TaskGraphNodeID AddTask(const std::string &name, TaskFunc func, void *data, std::initializer_list<TaskGraphNodeID> dependencies = {}, TaskPriority priority = TaskPriority::Critical);
+		TaskGraphNodeID AddContextTask(const std::string &name, TaskFunc func, void *data, std::initializer_list<TaskGraphNodeID> dependencies = {});
+		void AddDependency(TaskGraphNodeID node, TaskGraphNodeID dependency);
+
+		// Blocks until every node has run, running context nodes on the
+		// calling thread as they become ready. When called inside an
+		// UncheckedAllocationScope, the nodes run inside one as well,
+		// whichever thread they end up on.
+		void Execute(ThreadPool &pool);
+
+		// Logs when and where every node ran, the total wall time and the
+		// longest dependency chain.
+		void LogTimings(const char *title) const;
+
+		inline uint32_t GetNodeCount() const { return (uint32_t)mNodes.size(); }
+		inline const TaskGraphNode &GetNode(TaskGraphNodeID id) const { return *mNodes[id]; }
+		inline uint64_t GetWallMicros() const { return mEndMicros - mStartMicros; }
+		uint64_t GetCriticalPathMicros() const;
+
+	private:
+		TaskGraphNodeID AddNode(const std::string &name, TaskFunc func, void *data, std::initializer_list<TaskGraphNodeID> dependencies, TaskPriority priority, bool contextThread);
+
+		static void *RunNodeTask(void *data);
+		void RunNode(TaskGraphNode *node);
+		void Dispatch(TaskGraphNode *node);
+
+	private:
+		std::vector<TaskGraphNode*> mNodes;
+		ThreadPool *mPool;
+		MPSCQueue<TaskGraphNode*> *mContextQueue;
+		Semaphore mContextWake;
+		std::atomic<uint32_t> mCompleted;
+		bool mUncheckedAllocations;
+		uint64_t mStartMicros;
+		uint64_t mEndMicros;
+	};
+
+}
\ No newline at end of file
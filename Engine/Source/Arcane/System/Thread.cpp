@@ -1,11 +1,84 @@
 #include "Thread.hpp"
 
+#define AR_SPIN_YIELD_THRESHOLD 64
+
 namespace Arcane {
 
+	// Exponential pause backoff that falls back to yielding the time slice
+	// once the spinning stops paying off.
+	static inline void Backoff(uint32_t &iteration) {
+		if (iteration < AR_SPIN_YIELD_THRESHOLD) {
+			for (uint32_t i = 0; i < iteration; i++) {
+				AR_CPU_PAUSE();
+			}
+			iteration *= 2;
+		} else {
+			NativeThread::Switch();
+		}
+	}
+
+	void SpinLock::LockSlow() {
+		uint32_t iteration = 1;
+		while (true) {
+			if (!mLocked.load(std::memory_order_relaxed) && !mLocked.exchange(true, std::memory_order_acquire)) return;
+			Backoff(iteration);
+		}
+	}
+
+	void TicketLock::LockSlow(uint32_t ticket) {
+		uint32_t iteration = 1;
+		while (true) {
+			const uint32_t serving = mServing.load(std::memory_order_acquire);
+			if (serving == ticket) return;
+
+			// Waiters far back in line yield right away instead of spinning.
+			if (ticket - serving > 1) {
+				NativeThread::Switch();
+			} else {
+				Backoff(iteration);
+			}
+		}
+	}
+
+	void SharedMutex::LockSlow() {
+		mState.fetch_add(WaitingWriter, std::memory_order_relaxed);
+
+		uint32_t iteration = 1;
+		while (true) {
+			uint32_t state = mState.load(std::memory_order_relaxed);
+			if ((state & (WriterBit | ReaderMask)) == 0 &&
+				mState.compare_exchange_weak(state, (state - WaitingWriter) | WriterBit, std::memory_order_acquire, std::memory_order_relaxed)) {
+				return;
+			}
+			Backoff(iteration);
+		}
+	}
+
+	void SharedMutex::LockSharedSlow() {
+		uint32_t iteration = 1;
+		while (true) {
+			uint32_t state = mState.load(std::memory_order_relaxed);
+			if ((state & (WriterBit | WaitingWriterMask)) == 0) {
+				AR_ASSERT((state & ReaderMask) != ReaderMask, "Too many readers on shared mutex");
+				if (mState.compare_exchange_weak(state, state + 1, std::memory_order_acquire, std::memory_order_relaxed)) return;
+				continue;
+			}
+			Backoff(iteration);
+		}
+	}
+
 	Mutex Mutex::Create() {
 		return Mutex(NativeMutex::Create());
 	}
 
+	ConditionVariable ConditionVariable::Create() {
+		return ConditionVariable(NativeConditionVariable::Create());
+	}
+
+	Semaphore Semaphore::Create(uint32_t count) {
+		return Semaphore(NativeSemaphore::Create(count));
+	}
+
 	Thread Thread::Create(ThreadFunc func, void *data) {
 		return Thread(NativeThread::Create(func, data));
 	}
@@ -18,6 +91,10 @@ namespace Arcane {
 		NativeThread::Sleep(millis);
 	}
 
+	void Thread::Switch() {
+		NativeThread::Switch();
+	}
+
 	void Thread::Await(const Thread &thread, uint32_t max) {
 		NativeThread::Await(thread.GetNativeHandle(), max);
 	}
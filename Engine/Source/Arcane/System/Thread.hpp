@@ -2,6 +2,7 @@
 
 #include <Arcane/Core.hpp>
 #include <Arcane/Native/NativeThread.hpp>
+#include <atomic>
 
 namespace Arcane {
 
@@ -14,10 +15,10 @@ namespace Arcane {
 		Mutex(const Ref<NativeMutex> &mutex) : mNativeMutex(mutex) { }
 		~Mutex() = default;
 
-		inline void Lock() { GetNativeHandle()->Lock(); }
-		inline void Unlock() { GetNativeHandle()->Unlock(); }
+		inline void Lock() { mNativeMutex->Lock(); }
+		inline void Unlock() { mNativeMutex->Unlock(); }
 
-		inline Ref<NativeMutex> GetNativeHandle() const {
+		inline const Ref<NativeMutex> &GetNativeHandle() const {
 			AR_ASSERT(mNativeMutex, "Native mutex handle is null");
 			return mNativeMutex;
 		}
@@ -26,13 +27,191 @@ namespace Arcane {
 		Ref<NativeMutex> mNativeMutex;
 	};
 
+	class ConditionVariable {
+	public:
+		static ConditionVariable Create();
+
+	public:
+		ConditionVariable() = default;
+		ConditionVariable(const Ref<NativeConditionVariable> &conditionVariable) : mNativeConditionVariable(conditionVariable) { }
+		~ConditionVariable() = default;
+
+		inline void Wait(Mutex &mutex) { mNativeConditionVariable->Wait(mutex.GetNativeHandle()); }
+		inline bool Wait(Mutex &mutex, uint32_t millis) { return mNativeConditionVariable->Wait(mutex.GetNativeHandle(), millis); }
+		inline void NotifyOne() { mNativeConditionVariable->NotifyOne(); }
+		inline void NotifyAll() { mNativeConditionVariable->NotifyAll(); }
+
+		inline const Ref<NativeConditionVariable> &GetNativeHandle() const {
+			AR_ASSERT(mNativeConditionVariable, "Native condition variable handle is null");
+			return mNativeConditionVariable;
+		}
+
+	private:
+		Ref<NativeConditionVariable> mNativeConditionVariable;
+	};
+
+	class Semaphore {
+	public:
+		static Semaphore Create(uint32_t count = 0);
+
+	public:
+		Semaphore() = default;
+		Semaphore(const Ref<NativeSemaphore> &semaphore) : mNativeSemaphore(semaphore) { }
+		~Semaphore() = default;
+
+		inline void Wait() { mNativeSemaphore->Wait(); }
+		inline bool TryWait() { return mNativeSemaphore->TryWait(); }
+		inline void Post(uint32_t count = 1) { mNativeSemaphore->Post(count); }
+
+		inline const Ref<NativeSemaphore> &GetNativeHandle() const {
+			AR_ASSERT(mNativeSemaphore, "Native semaphore handle is null");
+			return mNativeSemaphore;
+		}
+
+	private:
+		Ref<NativeSemaphore> mNativeSemaphore;
+	};
+
+	// Test-and-test-and-set lock for very short critical sections. Never
+	// allocates and never enters the kernel; contended lockers back off and
+	// eventually yield their time slice.
+	class SpinLock {
+	public:
+		SpinLock() : mLocked(false) { }
+		SpinLock(const SpinLock &) = delete;
+		SpinLock &operator=(const SpinLock &) = delete;
+		~SpinLock() = default;
+
+		inline void Lock() {
+			if (!mLocked.exchange(true, std::memory_order_acquire)) return;
+			LockSlow();
+		}
+
+		inline bool TryLock() {
+			return !mLocked.load(std::memory_order_relaxed) && !mLocked.exchange(true, std::memory_order_acquire);
+		}
+
+		inline void Unlock() { mLocked.store(false, std::memory_order_release); }
+
+	private:
+		void LockSlow();
+
+	private:
+		std::atomic<bool> mLocked;
+	};
+
+	// FIFO spin lock: threads acquire the lock in the order they asked for it,
+	// so no waiter can be starved under heavy contention.
+	class TicketLock {
+	public:
+		TicketLock() : mNextTicket(0), mServing(0) { }
+		TicketLock(const TicketLock &) = delete;
+		TicketLock &operator=(const TicketLock &) = delete;
+		~TicketLock() = default;
+
+		inline void Lock() {
+			const uint32_t ticket = mNextTicket.fetch_add(1, std::memory_order_relaxed);
+			if (mServing.load(std::memory_order_acquire) == ticket) return;
+			LockSlow(ticket);
+		}
+
+		inline bool TryLock() {
+			uint32_t serving = mServing.load(std::memory_order_acquire);
+			return mNextTicket.compare_exchange_strong(serving, serving + 1, std::memory_order_acquire, std::memory_order_relaxed);
+		}
+
+		inline void Unlock() {
+			mServing.store(mServing.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+		}
+
+	private:
+		void LockSlow(uint32_t ticket);
+
+	private:
+		std::atomic<uint32_t> mNextTicket;
+		std::atomic<uint32_t> mServing;
+	};
+
+	// Writer-preferring reader-writer lock packed into one word: the low bits
+	// count active readers, the middle bits count waiting writers and the top
+	// bit marks an active writer. New readers are held back while any writer
+	// is waiting, so read-mostly data cannot starve its writers.
+	class SharedMutex {
+	public:
+		SharedMutex() : mState(0) { }
+		SharedMutex(const SharedMutex &) = delete;
+		SharedMutex &operator=(const SharedMutex &) = delete;
+		~SharedMutex() = default;
+
+		inline void Lock() {
+			uint32_t expected = 0;
+			if (mState.compare_exchange_strong(expected, WriterBit, std::memory_order_acquire, std::memory_order_relaxed)) return;
+			LockSlow();
+		}
+
+		inline bool TryLock() {
+			uint32_t expected = 0;
+			return mState.compare_exchange_strong(expected, WriterBit, std::memory_order_acquire, std::memory_order_relaxed);
+		}
+
+		inline void Unlock() { mState.fetch_and(~WriterBit, std::memory_order_release); }
+
+		inline void LockShared() {
+			uint32_t state = mState.load(std::memory_order_relaxed);
+			if ((state & (WriterBit | WaitingWriterMask)) == 0 &&
+				mState.compare_exchange_weak(state, state + 1, std::memory_order_acquire, std::memory_order_relaxed)) {
+				return;
+			}
+			LockSharedSlow();
+		}
+
+		inline bool TryLockShared() {
+			uint32_t state = mState.load(std::memory_order_relaxed);
+			return (state & (WriterBit | WaitingWriterMask)) == 0 &&
+				mState.compare_exchange_strong(state, state + 1, std::memory_order_acquire, std::memory_order_relaxed);
+		}
+
+		inline void UnlockShared() { mState.fetch_sub(1, std::memory_order_release); }
+
+	private:
+		void LockSlow();
+		void LockSharedSlow();
+
+	private:
+		static constexpr uint32_t ReaderMask = 0x0000FFFF;
+		static constexpr uint32_t WaitingWriter = 0x00010000;
+		static constexpr uint32_t WaitingWriterMask = 0x7FFF0000;
+		static constexpr uint32_t WriterBit = 0x80000000;
+
+		std::atomic<uint32_t> mState;
+	};
+
+	template<typename _Lock = Mutex>
 	class ScopedLock {
 	public:
-		ScopedLock(Mutex &mutex) : mMutex(mutex) { mMutex.Lock(); }
-		~ScopedLock() { mMutex.Unlock(); }
+		ScopedLock(_Lock &lock) : mLock(lock) { mLock.Lock(); }
+		~ScopedLock() { mLock.Unlock(); }
+
+	private:
+		_Lock &mLock;
+	};
+
+	class ScopedReadLock {
+	public:
+		ScopedReadLock(SharedMutex &mutex) : mMutex(mutex) { mMutex.LockShared(); }
+		~ScopedReadLock() { mMutex.UnlockShared(); }
+
+	private:
+		SharedMutex &mMutex;
+	};
+
+	class ScopedWriteLock {
+	public:
+		ScopedWriteLock(SharedMutex &mutex) : mMutex(mutex) { mMutex.Lock(); }
+		~ScopedWriteLock() { mMutex.Unlock(); }
 
 	private:
-		Mutex &mMutex;
+		SharedMutex &mMutex;
 	};
 
 	class Thread {
@@ -40,6 +219,7 @@ namespace Arcane {
 		static Thread Create(ThreadFunc func, void *data);
 		static void Exit(int32_t code);
 		static void Sleep(uint32_t millis);
+		static void Switch();
 		static void Await(const Thread &thread, uint32_t max = UINT32_MAX);
 		static Thread GetCurrent();
 
@@ -51,10 +231,11 @@ namespace Arcane {
 		inline void Start() { GetNativeHandle()->Start(); }
 		inline void Suspend() { GetNativeHandle()->Suspend(); }
 		inline void Terminate(int32_t code) { GetNativeHandle()->Terminate(code); }
+		inline void SetAffinity(const CPUSet &cpus) { GetNativeHandle()->SetAffinity(cpus); }
 		inline int32_t GetExitCode() const { return GetNativeHandle()->GetExitCode();}
 		inline ThreadID GetID() const { return GetNativeHandle()->GetID(); }
 
-		inline Ref<NativeThread> GetNativeHandle() const {
+		inline const Ref<NativeThread> &GetNativeHandle() const {
 			AR_ASSERT(mNativeHandle, "");
 			return mNativeHandle;
 		}
@@ -1,56 +1,390 @@
 #include "ThreadPool.hpp"
 
+#include "Time.hpp"
+#include "Arena.hpp"
+#include <Arcane/Math/Math.hpp>
+#include <algorithm>
+
 namespace Arcane {
 
-	int32_t WorkerThreadFunc(void *data) {
-		std::vector<Task> &tasks = *(std::vector<Task>*)data;
+	static thread_local Worker *sCurrentWorker = nullptr;
+	static ThreadPool *sThreadPool = nullptr;
+
+	// Worker counters have a single writer, so a plain load and store is
+	// enough and avoids a locked instruction.
+	static inline void Increment(std::atomic<uint64_t> &counter, uint64_t value = 1) {
+		counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+	}
+
+	int32_t ThreadPool::WorkerMain(void *data) {
+		Worker *worker = (Worker*)data;
+		ThreadPool *pool = worker->Pool;
+
+		sCurrentWorker = worker;
+		worker->ID = Thread::GetCurrent().GetID();
+		worker->StartTime.store(GetCurrentTimeMicros(), std::memory_order_relaxed);
+		AR_PROFILE_THREAD_NAME(worker->Name.c_str());
+
 		while (true) {
-			if (tasks.empty()) {
-				Thread::Sleep(100);
+			TaskID id;
+			if (pool->PopTask(worker, id, !pool->IsBackgroundDeferred())) {
+				pool->ExecuteTask(id, worker->ID);
 				continue;
 			}
-			Task &t = tasks.front();
-			t.ThreadIndex = Thread::GetCurrent().GetID();
-			t.Result = t.Func(t.Data);
-			t.Completed = true;
+
+			const uint64_t idleStart = GetCurrentTimeMicros();
+			worker->IdleSince.store(idleStart, std::memory_order_relaxed);
+			pool->mWorkAvailable.Wait();
+			worker->IdleSince.store(0, std::memory_order_relaxed);
+			Increment(worker->IdleMicros, GetCurrentTimeMicros() - idleStart);
+
+			if (!pool->mRunning.load(std::memory_order_acquire)) break;
 		}
+
+		sCurrentWorker = nullptr;
+		return 0;
 	}
 
-	ThreadPool::ThreadPool(uint32_t count) {
-		mNextTaskID = 0;
-		mThreads.reserve(count);
+	ThreadPool::ThreadPool(uint32_t count) : mRunning(true), mQueues{ AR_MAX_TASKS, AR_MAX_TASKS, AR_MAX_TASKS },
+		mFrameBudget(0), mFrameMargin(0), mFrameDeadline(0), mBackgroundCutoff(UINT64_MAX), mFrameDeadlineStats{}, mTaskChunkCount(0), mFreeTasks(AR_MAX_TASKS) {
+		mWorkAvailable = Semaphore::Create(0);
+		for (uint32_t i = 0; i < AR_MAX_TASK_CHUNKS; i++) {
+			mTaskChunks[i].store(nullptr, std::memory_order_relaxed);
+		}
+
+		const CPUTopology &topology = GetCPUTopology();
+		const std::vector<uint32_t> cores = GetUnreservedCores();
+		if (count == 0) count = Max((uint32_t)cores.size(), 1u);
+
+		std::vector<uint32_t> workerCores(count, UINT32_MAX);
+		if (!cores.empty()) {
+			for (uint32_t i = 0; i < count; i++) workerCores[i] = cores[i % cores.size()];
+		}
+
+		mWorkers.reserve(count);
 		for (uint32_t i = 0; i < count; i++) {
-			mThreads.push_back(Thread::Create(WorkerThreadFunc, &mTasks));
+			mWorkers.push_back(new Worker(this, i));
+		}
+
+		for (uint32_t i = 0; i < count; i++) {
+			Worker *worker = mWorkers[i];
+
+			for (uint32_t j = 0; j < count; j++) {
+				if (j != i) worker->Victims.push_back(j);
+			}
+
+			if (workerCores[i] != UINT32_MAX) {
+				const PhysicalCore &core = topology.PhysicalCores[workerCores[i]];
+				std::stable_sort(worker->Victims.begin(), worker->Victims.end(), [&](uint32_t a, uint32_t b) {
+					auto distance = [&](uint32_t victim) {
+						if (workerCores[victim] == UINT32_MAX) return 2;
+						const PhysicalCore &other = topology.PhysicalCores[workerCores[victim]];
+						if (other.L3Group == core.L3Group) return 0;
+						if (other.NUMANode == core.NUMANode) return 1;
+						return 2;
+					};
+					return distance(a) < distance(b);
+				});
+			}
+
+			worker->Core = workerCores[i];
+			worker->Name = "Worker " + std::to_string(i);
+			worker->UtilizationPlot = worker->Name + " Utilization";
+			worker->QueueDepthPlot = worker->Name + " Queue Depth";
+
+			worker->Handle = Thread::Create(WorkerMain, worker);
+			if (workerCores[i] != UINT32_MAX) PinThread(worker->Handle, workerCores[i]);
+			worker->Handle.Start();
 		}
 	}
 
 	ThreadPool::~ThreadPool() {
-		for (uint32_t i = 0; i < mThreads.size(); i++) {
-			mThreads[i].Terminate(-1);
+		mRunning.store(false, std::memory_order_release);
+		mWorkAvailable.Post((uint32_t)mWorkers.size());
+
+		for (Worker *worker : mWorkers) {
+			Thread::Await(worker->Handle);
+		}
+
+		for (Worker *worker : mWorkers) {
+			delete worker;
+		}
+
+		for (uint32_t i = 0; i < mTaskChunkCount; i++) {
+			delete[] mTaskChunks[i].load(std::memory_order_relaxed);
 		}
 	}
 
-	TaskID ThreadPool::AddTask(TaskFunc func, void *data) {
-		return mTasks.emplace_back(
-			mNextTaskID++,
-			func,
-			data
-		).ID;
+	TaskID ThreadPool::AddTask(TaskFunc func, void *data, TaskPriority priority, const char *name) {
+		return QueueTask(func, data, priority, name, false);
+	}
+
+	void ThreadPool::AddDetachedTask(TaskFunc func, void *data, TaskPriority priority, const char *name) {
+		QueueTask(func, data, priority, name, true);
+	}
+
+	TaskID ThreadPool::QueueTask(TaskFunc func, void *data, TaskPriority priority, const char *name, bool detached) {
+		const uint32_t index = AllocateTask();
+		Task &task = GetTask(index);
+
+		const TaskID id = (task.ID & 0xFFFF0000) + 0x10000 + index;
+		task.ID = id;
+		task.Func = func;
+		task.Data = data;
+		task.Result = nullptr;
+		task.ThreadIndex = UINT32_MAX;
+		task.Priority = priority;
+		task.Name = name ? name : "Task";
+		task.Detached = detached;
+		task.State.store(TaskState::Pending, std::memory_order_release);
+
+		Worker *worker = GetCurrentWorker();
+		const uint32_t queue = (uint32_t)priority;
+		if (!(worker && worker->Queues[queue].Push(id)) && !mQueues[queue].Push(id)) {
+			AR_ENGINE_WARNING("Task queue is full, running task {} on the calling thread", id);
+			ExecuteTask(id, Thread::GetCurrent().GetID());
+			return id;
+		}
+
+		mWorkAvailable.Post();
+		return id;
 	}
 
 	void *ThreadPool::AwaitTask(TaskID id) {
-		uint32_t index = UINT32_MAX;
+		Task &task = GetTask(id & 0xFFFF);
+		AR_ASSERT(task.ID == id && task.State.load() != TaskState::Free, "Task {} has already been awaited", id);
+		AR_ASSERT(!task.Detached, "Detached task {} cannot be awaited", id);
+
+		// Run other tasks while waiting so a worker awaiting a task it
+		// spawned can never deadlock the pool. Background tasks are allowed
+		// here even past the deadline, since the awaited task may be one.
+		while (task.State.load(std::memory_order_acquire) != TaskState::Completed) {
+			if (!RunPendingTask()) Thread::Switch();
+		}
+
+		void *result = task.Result;
+		task.State.store(TaskState::Free, std::memory_order_relaxed);
+		mFreeTasks.Push(id & 0xFFFF);
+		return result;
+	}
+
+	bool ThreadPool::RunPendingTask() {
+		Worker *worker = GetCurrentWorker();
+
+		TaskID id;
+		if (!PopTask(worker, id, true)) return false;
+
+		ExecuteTask(id, worker ? worker->ID : Thread::GetCurrent().GetID());
+		return true;
+	}
+
+	void ThreadPool::SetFrameBudget(uint32_t budgetMicros, uint32_t marginMicros) {
+		mFrameBudget = budgetMicros;
+		mFrameMargin = (marginMicros == 0) ? budgetMicros / 4 : Min(marginMicros, budgetMicros);
+	}
+
+	void ThreadPool::BeginFrame() {
+		if (mFrameBudget == 0) return;
+
+		mFrameDeadline = GetCurrentTimeMicros() + mFrameBudget;
+		mBackgroundCutoff.store(mFrameDeadline - mFrameMargin, std::memory_order_relaxed);
+	}
+
+	void ThreadPool::EndFrame() {
+		const uint64_t now = GetCurrentTimeMicros();
+
+		for (Worker *worker : mWorkers) {
+			const uint64_t busy = GetBusyMicros(worker, now);
+			const uint64_t idle = GetIdleMicros(worker, now);
+			const uint64_t frameBusy = busy - Min(busy, worker->FrameBusyMicros);
+			const uint64_t frameIdle = idle - Min(idle, worker->FrameIdleMicros);
+			worker->FrameBusyMicros = busy;
+			worker->FrameIdleMicros = idle;
+
+			[[maybe_unused]] const uint64_t frameTime = frameBusy + frameIdle;
+			AR_PROFILE_PLOT(worker->UtilizationPlot.c_str(), frameTime ? (double)frameBusy / (double)frameTime : 0.0);
+			AR_PROFILE_PLOT(worker->QueueDepthPlot.c_str(), (int64_t)GetQueueDepth(worker));
+		}
+
+		const uint64_t cutoff = mBackgroundCutoff.exchange(UINT64_MAX, std::memory_order_relaxed);
+		if (cutoff == UINT64_MAX) return;
 
-		for (uint32_t i = 0; i < mTasks.size(); i++) {
-			if (mTasks[i].ID == id) index = i;
+		mFrameDeadlineStats.Frames++;
+		if (now >= cutoff) mFrameDeadlineStats.DeadlineHits++;
+		if (now >= mFrameDeadline) mFrameDeadlineStats.DeadlineMisses++;
+
+		// Workers that skipped deferred background tasks went back to sleep.
+		const uint32_t background = (uint32_t)TaskPriority::Background;
+		size_t deferred = mQueues[background].GetSize();
+		for (Worker *worker : mWorkers) {
+			deferred += worker->Queues[background].GetSize();
+		}
+
+		if (deferred > 0) mWorkAvailable.Post((uint32_t)Min(deferred, mWorkers.size()));
+	}
+
+	JobSystemStats ThreadPool::GetStats() const {
+		const uint64_t now = GetCurrentTimeMicros();
+
+		JobSystemStats stats{};
+		stats.Workers.reserve(mWorkers.size());
+		for (const Worker *worker : mWorkers) {
+			WorkerStats &workerStats = stats.Workers.emplace_back();
+			workerStats.ID = worker->Handle.GetID();
+			workerStats.Core = worker->Core;
+			workerStats.BusyMicros = GetBusyMicros(worker, now);
+			workerStats.IdleMicros = GetIdleMicros(worker, now);
+			workerStats.Jobs = worker->Jobs.load(std::memory_order_relaxed);
+			workerStats.StealAttempts = worker->StealAttempts.load(std::memory_order_relaxed);
+			workerStats.Steals = worker->Steals.load(std::memory_order_relaxed);
+			workerStats.QueueDepth = GetQueueDepth(worker);
+			workerStats.CurrentTask = worker->CurrentTask.load(std::memory_order_relaxed);
+
+			const uint64_t taskStart = worker->CurrentTaskStart.load(std::memory_order_relaxed);
+			workerStats.CurrentTaskMicros = (workerStats.CurrentTask && now > taskStart) ? now - taskStart : 0;
+		}
+
+		for (uint32_t i = 0; i < AR_TASK_PRIORITY_COUNT; i++) {
+			stats.QueueDepth += mQueues[i].GetSize();
+		}
+
+		return stats;
+	}
+
+	uint64_t ThreadPool::GetIdleMicros(const Worker *worker, uint64_t now) {
+		const uint64_t idleSince = worker->IdleSince.load(std::memory_order_relaxed);
+		return worker->IdleMicros.load(std::memory_order_relaxed) + ((idleSince != 0 && now > idleSince) ? now - idleSince : 0);
+	}
+
+	uint64_t ThreadPool::GetBusyMicros(const Worker *worker, uint64_t now) {
+		const uint64_t start = worker->StartTime.load(std::memory_order_relaxed);
+		if (start == 0 || now <= start) return 0;
+
+		const uint64_t idle = GetIdleMicros(worker, now);
+		return now - start > idle ? now - start - idle : 0;
+	}
+
+	size_t ThreadPool::GetQueueDepth(const Worker *worker) {
+		size_t depth = 0;
+		for (uint32_t i = 0; i < AR_TASK_PRIORITY_COUNT; i++) {
+			depth += worker->Queues[i].GetSize();
+		}
+		return depth;
+	}
+
+	bool ThreadPool::IsBackgroundDeferred() const {
+		const uint64_t cutoff = mBackgroundCutoff.load(std::memory_order_relaxed);
+		return cutoff != UINT64_MAX && GetCurrentTimeMicros() >= cutoff;
+	}
+
+	uint32_t ThreadPool::AllocateTask() {
+		uint32_t index;
+		while (!mFreeTasks.Pop(index)) {
+			ScopedLock lock(mTaskChunkLock);
+			if (mFreeTasks.Pop(index)) break;
+
+			const uint32_t chunk = mTaskChunkCount;
+			AR_ASSERT(chunk < AR_MAX_TASK_CHUNKS, "More than {} tasks are waiting to be awaited", AR_MAX_TASKS);
+
+			mTaskChunks[chunk].store(new Task[AR_TASK_CHUNK_SIZE], std::memory_order_release);
+			mTaskChunkCount = chunk + 1;
+
+			index = chunk * AR_TASK_CHUNK_SIZE;
+			for (uint32_t i = 1; i < AR_TASK_CHUNK_SIZE; i++) {
+				mFreeTasks.Push(index + i);
+			}
+			break;
 		}
 
-		while (!mTasks[index].Completed) {
-			Thread::Sleep(10);
+		return index;
+	}
+
+	Worker *ThreadPool::GetCurrentWorker() const {
+		return (sCurrentWorker && sCurrentWorker->Pool == this) ? sCurrentWorker : nullptr;
+	}
+
+	bool ThreadPool::PopTask(Worker *worker, TaskID &id, bool allowBackground) {
+		const uint32_t priorities = allowBackground ? AR_TASK_PRIORITY_COUNT : (uint32_t)TaskPriority::Background;
+
+		for (uint32_t priority = 0; priority < priorities; priority++) {
+			if (worker && worker->Queues[priority].Pop(id)) return true;
+			if (mQueues[priority].Pop(id)) return true;
+
+			if (worker) {
+				for (uint32_t victim : worker->Victims) {
+					Increment(worker->StealAttempts);
+					if (mWorkers[victim]->Queues[priority].Pop(id)) {
+						Increment(worker->Steals);
+						return true;
+					}
+				}
+			} else {
+				for (Worker *other : mWorkers) {
+					if (other->Queues[priority].Pop(id)) return true;
+				}
+			}
 		}
 
-		return mTasks[index].Result;
+		return false;
 	}
 
+	void ThreadPool::ExecuteTask(TaskID id, ThreadID thread) {
+		Task &task = GetTask(id & 0xFFFF);
+		task.ThreadIndex = thread;
+
+		// Nested tasks run from AwaitTask() restore the outer task's name.
+		Worker *worker = GetCurrentWorker();
+		const char *outerTask = nullptr;
+		uint64_t outerStart = 0;
+		if (worker) {
+			outerTask = worker->CurrentTask.load(std::memory_order_relaxed);
+			outerStart = worker->CurrentTaskStart.load(std::memory_order_relaxed);
+			worker->CurrentTaskStart.store(GetCurrentTimeMicros(), std::memory_order_relaxed);
+			worker->CurrentTask.store(task.Name, std::memory_order_relaxed);
+		}
+
+		{
+			AR_PROFILE_DYNAMIC_SCOPE(task.Name);
+			ScratchScope scratch;
+			task.Result = task.Func(task.Data);
+		}
+
+		if (worker) {
+			worker->CurrentTask.store(outerTask, std::memory_order_relaxed);
+			worker->CurrentTaskStart.store(outerStart, std::memory_order_relaxed);
+			Increment(worker->Jobs);
+		}
+
+		if (task.Detached) {
+			task.State.store(TaskState::Free, std::memory_order_relaxed);
+			mFreeTasks.Push(id & 0xFFFF);
+			return;
+		}
+
+		task.State.store(TaskState::Completed, std::memory_order_release);
+	}
+
+	void InitThreadPool(uint32_t count) {
+		AR_ASSERT(!sThreadPool, "Thread pool is already initialized");
+		sThreadPool = new ThreadPool(count);
+	}
+
+	void ShutdownThreadPool() {
+		delete sThreadPool;
+		sThreadPool = nullptr;
+	}
+
+	ThreadPool &GetThreadPool() {
+		AR_ASSERT(sThreadPool, "Thread pool is not initialized");
+		return *sThreadPool;
+	}
+
+	bool HasThreadPool() {
+		return sThreadPool != nullptr;
+	}
+
+	JobSystemStats GetJobSystemStats() {
+		return GetThreadPool().GetStats();
+	}
 
 }
\ No newline at end of file
@@ -1,38 +1,185 @@
 #pragma once
 
 #include <Arcane/Core.hpp>
+#include <Arcane/Data/Queue.hpp>
 #include "Thread.hpp"
+#include "CPU.hpp"
 #include <vector>
 
+#define AR_TASK_CHUNK_SIZE 1024
+#define AR_MAX_TASK_CHUNKS 64
+#define AR_MAX_TASKS (AR_TASK_CHUNK_SIZE * AR_MAX_TASK_CHUNKS)
+#define AR_WORKER_QUEUE_SIZE 1024
+#define AR_TASK_PRIORITY_COUNT 3
+
 namespace Arcane {
 
 	typedef void *(*TaskFunc)(void *data);
 
 	typedef uint32_t TaskID;
 
+	// Workers always drain every queue of a higher priority before looking
+	// at a lower one.
+	enum class TaskPriority : uint32_t {
+		Critical = 0, Normal, Background
+	};
+
+	enum class TaskState : uint32_t {
+		Free = 0, Pending, Completed
+	};
+
 	struct Task {
-		Task(TaskID id, TaskFunc func, void *data) : ID(id), Func(func), Result(nullptr), Data(data), ThreadIndex(UINT32_MAX), Completed(false) { }
+		Task() : ID(0), Func(nullptr), Result(nullptr), Data(nullptr), ThreadIndex(UINT32_MAX), Priority(TaskPriority::Normal), Name(nullptr), Detached(false), State(TaskState::Free) { }
 		~Task() { }
 
+		// Low 16 bits index the task storage, the rest is a generation that
+		// catches stale IDs.
 		TaskID ID;
 		TaskFunc Func;
 		void *Result;
 		void *Data;
 		uint32_t ThreadIndex;
-		bool Completed;
+		TaskPriority Priority;
+		const char *Name;
+		bool Detached;
+		std::atomic<TaskState> State;
+	};
+
+	class ThreadPool;
+
+	struct WorkerStats {
+		ThreadID ID;
+		uint32_t Core;
+		uint64_t BusyMicros;
+		uint64_t IdleMicros;
+		uint64_t Jobs;
+		uint64_t StealAttempts;
+		uint64_t Steals;
+		size_t QueueDepth;
+		// Name and running time of the task being executed, if any.
+		const char *CurrentTask;
+		uint64_t CurrentTaskMicros;
+	};
+
+	struct JobSystemStats {
+		std::vector<WorkerStats> Workers;
+		// Tasks waiting in the shared queues.
+		size_t QueueDepth;
+	};
+
+	struct Worker {
+		Worker(ThreadPool *pool, uint32_t index) : Pool(pool), Index(index), ID(0), Core(UINT32_MAX), Queues{ AR_WORKER_QUEUE_SIZE, AR_WORKER_QUEUE_SIZE, AR_WORKER_QUEUE_SIZE },
+			StartTime(0), IdleMicros(0), IdleSince(0), Jobs(0), StealAttempts(0), Steals(0), CurrentTask(nullptr), CurrentTaskStart(0), FrameBusyMicros(0), FrameIdleMicros(0) { }
+
+		ThreadPool *Pool;
+		uint32_t Index;
+		ThreadID ID;
+		uint32_t Core;
+		Thread Handle;
+		MPMCQueue<TaskID> Queues[AR_TASK_PRIORITY_COUNT];
+		// Other workers in the order they are stolen from: same L3 cache
+		// first, then same NUMA node, then everything else.
+		std::vector<uint32_t> Victims;
+
+		// Only ever written by the worker itself.
+		std::atomic<uint64_t> StartTime;
+		std::atomic<uint64_t> IdleMicros;
+		std::atomic<uint64_t> IdleSince;
+		std::atomic<uint64_t> Jobs;
+		std::atomic<uint64_t> StealAttempts;
+		std::atomic<uint64_t> Steals;
+		std::atomic<const char*> CurrentTask;
+		std::atomic<uint64_t> CurrentTaskStart;
+
+		// Used by EndFrame() to plot per-frame utilization.
+		uint64_t FrameBusyMicros;
+		uint64_t FrameIdleMicros;
+		std::string Name;
+		std::string UtilizationPlot;
+		std::string QueueDepthPlot;
 	};
 
+	struct FrameDeadlineStats {
+		uint64_t Frames;
+		// Frames that ran into the deadline margin, deferring background tasks.
+		uint64_t DeadlineHits;
+		// Frames that ended after the deadline itself.
+		uint64_t DeadlineMisses;
+	};
+
+	// Every task must be awaited, unless it was added detached; that is
+	// what returns its storage to the pool.
+	//
+	// A count of 0 creates one worker per physical core that has not been
+	// reserved with ReserveCore(). Workers are pinned to their core, take
+	// work from their own queue first, then the shared queue, and then steal
+	// from the other workers.
 	class ThreadPool {
 	public:
-		ThreadPool(uint32_t count = 5);
+		ThreadPool(uint32_t count = 0);
 		~ThreadPool();
 
-		TaskID AddTask(TaskFunc func, void *data);
+		ThreadPool(const ThreadPool &) = delete;
+		ThreadPool &operator=(const ThreadPool &) = delete;
+
+		TaskID AddTask(TaskFunc func, void *data, TaskPriority priority = TaskPriority::Normal, const char *name = nullptr);
+		// Releases itself once it has run and must not be awaited. Meant for
+		// work started by other systems, like file reads completing.
+		void AddDetachedTask(TaskFunc func, void *data, TaskPriority priority = TaskPriority::Normal, const char *name = nullptr);
 		void *AwaitTask(TaskID id);
+		// Runs one queued task on the calling thread. Returns false if there
+		// was nothing to run.
+		bool RunPendingTask();
+
+		// A budget of 0 disables the deadline. Once less than marginMicros
+		// of the budget is left, background tasks are held back until
+		// EndFrame(). A margin of 0 uses a quarter of the budget.
+		void SetFrameBudget(uint32_t budgetMicros, uint32_t marginMicros = 0);
+		void BeginFrame();
+		void EndFrame();
+
+		inline uint32_t GetWorkerCount() const { return (uint32_t)mWorkers.size(); }
+		inline const FrameDeadlineStats &GetFrameDeadlineStats() const { return mFrameDeadlineStats; }
+		JobSystemStats GetStats() const;
+
+	private:
+		static int32_t WorkerMain(void *data);
+
+		TaskID QueueTask(TaskFunc func, void *data, TaskPriority priority, const char *name, bool detached);
+		uint32_t AllocateTask();
+		inline Task &GetTask(uint32_t index) { return mTaskChunks[index / AR_TASK_CHUNK_SIZE].load(std::memory_order_acquire)[index % AR_TASK_CHUNK_SIZE]; }
+
+		Worker *GetCurrentWorker() const;
+		bool PopTask(Worker *worker, TaskID &id, bool allowBackground);
+		bool IsBackgroundDeferred() const;
+
+		static uint64_t GetIdleMicros(const Worker *worker, uint64_t now);
+		static uint64_t GetBusyMicros(const Worker *worker, uint64_t now);
+		static size_t GetQueueDepth(const Worker *worker);
+		void ExecuteTask(TaskID id, ThreadID thread);
+
 	private:
-		uint32_t mNextTaskID;
-		std::vector<Thread> mThreads;
-		std::vector<Task> mTasks;
+		std::atomic<bool> mRunning;
+		std::vector<Worker*> mWorkers;
+		MPMCQueue<TaskID> mQueues[AR_TASK_PRIORITY_COUNT];
+		Semaphore mWorkAvailable;
+
+		uint32_t mFrameBudget;
+		uint32_t mFrameMargin;
+		uint64_t mFrameDeadline;
+		std::atomic<uint64_t> mBackgroundCutoff;
+		FrameDeadlineStats mFrameDeadlineStats;
+
+		std::atomic<Task*> mTaskChunks[AR_MAX_TASK_CHUNKS];
+		uint32_t mTaskChunkCount;
+		SpinLock mTaskChunkLock;
+		MPMCQueue<uint32_t> mFreeTasks;
 	};
+
+	void InitThreadPool(uint32_t count = 0);
+	void ShutdownThreadPool();
+	ThreadPool &GetThreadPool();
+	bool HasThreadPool();
+	JobSystemStats GetJobSystemStats();
 	
 }
\ No newline at end of file
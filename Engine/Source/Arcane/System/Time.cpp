@@ -29,4 +29,8 @@ namespace Arcane {
 		return _GetCurrentTimeMillis();
 	}
 
+	uint64_t GetCurrentTimeMicros() {
+		return _GetCurrentTimeMicros();
+	}
+
 }
\ No newline at end of file
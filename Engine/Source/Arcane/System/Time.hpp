@@ -9,6 +9,7 @@ namespace Arcane {
 	float Now();
 
 	uint64_t GetCurrentTimeMillis();
+	uint64_t GetCurrentTimeMicros();
 
 	class Timer {
 	public:
@@ -29,7 +29,7 @@ namespace Arcane {
 		inline Vector2 GetClientSize() const { return mNativeWindow->GetClientSize(); }
 		inline Vector2 GetScreenSize() const { return mNativeWindow->GetScreenSize(); }
 
-		inline Ref<NativeWindow> GetNativeWindow() const { return mNativeWindow; }
+		inline const Ref<NativeWindow> &GetNativeWindow() const { return mNativeWindow; }
 
 	private:
 		Ref<NativeWindow> mNativeWindow;
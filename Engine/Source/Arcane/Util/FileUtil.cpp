@@ -38,4 +38,17 @@ namespace Arcane {
 		return binary;
 	}
 
+	static void UnmapFileBuffer(BufferData *data) {
+		_UnmapFile(data->Pointer, data->Size);
+	}
+
+	MappedFile MappedFile::Open(const std::string &path, uint32_t hints) {
+		size_t size = 0;
+		void *pointer = _MapFile(path.c_str(), hints, &size);
+		AR_ASSERT(pointer, "Could not map file: {}", path);
+		if (pointer == nullptr) return MappedFile();
+
+		return MappedFile(WrapBuffer(pointer, size, UnmapFileBuffer));
+	}
+
 }
\ No newline at end of file
@@ -2,10 +2,39 @@
 
 #include <Arcane/Core.hpp>
 #include <Arcane/Data/BufferData.hpp>
+#include <Arcane/Native/NativeFile.hpp>
 
 namespace Arcane {
 
 	std::string ReadFile(const std::string &path);
 	BufferRef ReadFileBinary(const std::string &path);
+
+	// A whole file mapped read-only into memory, so that reading it does
+	// not copy it out of the page cache. The buffer, and every slice of it,
+	// keeps the mapping alive and must never be written to. On Linux the
+	// file must not be truncated while it is mapped.
+	class MappedFile {
+	public:
+		static MappedFile Open(const std::string &path, uint32_t hints = FileAccessHint_Sequential);
+
+	public:
+		MappedFile() { }
+		~MappedFile() { }
+
+		inline const BufferRef &GetBuffer() const { return mBuffer; }
+		inline const void *GetPointer() const { return mBuffer.GetPointer(); }
+		inline size_t GetSize() const { return mBuffer.GetSize(); }
+
+		inline BufferRef Slice(size_t offset, size_t size) const { return mBuffer.Slice(offset, size); }
+
+		inline bool IsValid() const { return mBuffer.IsValid(); }
+		inline operator bool() const { return IsValid(); }
+
+	private:
+		MappedFile(const BufferRef &buffer) : mBuffer(buffer) { }
+
+	private:
+		BufferRef mBuffer;
+	};
 	
 }
\ No newline at end of file
@@ -0,0 +1,57 @@
+#include "StringId.hpp"
+
+#include <Arcane/Data/HashMap.hpp>
+#include <Arcane/System/Arena.hpp>
+#include <Arcane/System/Memory.hpp>
+#include <mutex>
+
+namespace Arcane {
+
+#if AR_STRING_ID_NAMES
+	// Interned text is copied into an arena and kept until exit.
+	struct StringIdTable {
+		std::mutex Mutex;
+		HashMap<uint64_t, std::string_view> Strings;
+		LinearArena Storage;
+	};
+
+	static StringIdTable &GetStringIdTable() {
+		static StringIdTable table;
+		return table;
+	}
+#endif
+
+	StringId StringId::Intern(std::string_view string) {
+		const StringId id(string);
+
+#if AR_STRING_ID_NAMES
+		StringIdTable &table = GetStringIdTable();
+		std::lock_guard<std::mutex> lock(table.Mutex);
+
+		auto [entry, inserted] = table.Strings.Emplace(id.GetHash(), std::string_view());
+		if (inserted) {
+			char *text = table.Storage.AllocateArray<char>(string.size() + 1);
+			CopyMemory(text, string.data(), string.size());
+			text[string.size()] = '\0';
+			entry->Value = std::string_view(text, string.size());
+		} else {
+			AR_ASSERT(entry->Value == string, "StringId collision between '{}' and '{}'", entry->Value, string);
+		}
+#endif
+
+		return id;
+	}
+
+	std::string_view StringId::GetString() const {
+#if AR_STRING_ID_NAMES
+		StringIdTable &table = GetStringIdTable();
+		std::lock_guard<std::mutex> lock(table.Mutex);
+
+		const std::string_view *string = table.Strings.Find(mHash);
+		if (string != nullptr) return *string;
+#endif
+
+		return std::string_view();
+	}
+
+}
\ No newline at end of file
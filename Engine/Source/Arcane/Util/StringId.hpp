@@ -0,0 +1,60 @@
+#pragma once
+
+#include <Arcane/Core.hpp>
+#include <functional>
+#include <string_view>
+
+#ifndef AR_STRING_ID_NAMES
+#	ifdef _DEBUG
+#		define AR_STRING_ID_NAMES 1
+#	else
+#		define AR_STRING_ID_NAMES 0
+#	endif
+#endif
+
+#define AR_STRING_ID_OFFSET_BASIS 0xCBF29CE484222325ull
+#define AR_STRING_ID_PRIME 0x100000001B3ull
+
+namespace Arcane {
+
+	// 64-bit FNV-1a.
+	constexpr uint64_t HashString(std::string_view string) {
+		uint64_t hash = AR_STRING_ID_OFFSET_BASIS;
+		for (char c : string) {
+			hash ^= (uint8_t)c;
+			hash *= AR_STRING_ID_PRIME;
+		}
+		return hash;
+	}
+
+	// A string reduced to its hash, so that it can be compared and looked up
+	// as an integer. Ids made from literals are hashed at compile time;
+	// Intern() also records the text, when AR_STRING_ID_NAMES is enabled,
+	// so that GetString() can show it while debugging.
+	class StringId {
+	public:
+		static StringId Intern(std::string_view string);
+
+	public:
+		constexpr StringId() : mHash(0) { }
+		constexpr explicit StringId(std::string_view string) : mHash(HashString(string)) { }
+
+		// Empty unless the id was interned and names are enabled.
+		std::string_view GetString() const;
+
+		constexpr uint64_t GetHash() const { return mHash; }
+		constexpr bool IsValid() const { return mHash != 0; }
+
+		constexpr bool operator==(const StringId &other) const { return mHash == other.mHash; }
+		constexpr bool operator!=(const StringId &other) const { return mHash != other.mHash; }
+
+	private:
+		uint64_t mHash;
+	};
+
+}
+
+template<>
+struct std::hash<Arcane::StringId> {
+	inline size_t operator()(const Arcane::StringId &id) const { return (size_t)id.GetHash(); }
+};
\ No newline at end of file
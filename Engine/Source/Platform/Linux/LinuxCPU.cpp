@@ -0,0 +1,111 @@
+#ifdef __linux__
+
+#include <Arcane/Native/NativeCPU.hpp>
+
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <string>
+#include <dirent.h>
+#include <unistd.h>
+
+namespace Arcane {
+
+	static std::string ReadSysFile(const std::string &path) {
+		std::ifstream file(path);
+		std::string line;
+		if (!file || !std::getline(file, line)) return std::string();
+		while (!line.empty() && (line.back() == '\n' || line.back() == ' ')) line.pop_back();
+		return line;
+	}
+
+	static uint32_t ReadSysUInt(const std::string &path, uint32_t fallback) {
+		const std::string value = ReadSysFile(path);
+		if (value.empty()) return fallback;
+		return (uint32_t)strtoul(value.c_str(), nullptr, 10);
+	}
+
+	// Parses the kernel's CPU list format, e.g. "0-3,8-11".
+	static CPUSet ParseCPUList(const std::string &list) {
+		CPUSet cpus;
+		const char *current = list.c_str();
+
+		while (*current) {
+			char *end;
+			uint32_t first = (uint32_t)strtoul(current, &end, 10);
+			if (end == current) break;
+			uint32_t last = first;
+			current = end;
+
+			if (*current == '-') {
+				last = (uint32_t)strtoul(current + 1, &end, 10);
+				current = end;
+			}
+
+			for (uint32_t i = first; i <= last && i < AR_MAX_CPUS; i++) cpus.set(i);
+			if (*current == ',') current++;
+		}
+
+		return cpus;
+	}
+
+	static uint32_t FindNUMANode(const std::string &cpuPath) {
+		DIR *directory = opendir(cpuPath.c_str());
+		if (!directory) return 0;
+
+		uint32_t node = 0;
+		while (dirent *entry = readdir(directory)) {
+			if (strncmp(entry->d_name, "node", 4) == 0 && entry->d_name[4] >= '0' && entry->d_name[4] <= '9') {
+				node = (uint32_t)strtoul(entry->d_name + 4, nullptr, 10);
+				break;
+			}
+		}
+
+		closedir(directory);
+		return node;
+	}
+
+	static std::string FindL3SharedList(const std::string &cpuPath) {
+		for (uint32_t i = 0; i < 8; i++) {
+			const std::string indexPath = cpuPath + "cache/index" + std::to_string(i) + "/";
+			const std::string level = ReadSysFile(indexPath + "level");
+			if (level.empty()) break;
+			if (level == "3") return ReadSysFile(indexPath + "shared_cpu_list");
+		}
+		return std::string();
+	}
+
+	void _QueryCPUTopology(CPUTopology &topology) {
+		CPUSet online = ParseCPUList(ReadSysFile("/sys/devices/system/cpu/online"));
+		if (online.none()) {
+			const long count = sysconf(_SC_NPROCESSORS_ONLN);
+			for (long i = 0; i < count && i < AR_MAX_CPUS; i++) online.set(i);
+		}
+
+		std::map<std::pair<uint32_t, uint32_t>, uint32_t> cores;
+		std::map<std::string, uint32_t> l3Groups;
+		std::map<uint32_t, uint32_t> nodes;
+
+		for (uint32_t cpu = 0; cpu < AR_MAX_CPUS; cpu++) {
+			if (!online.test(cpu)) continue;
+
+			const std::string cpuPath = "/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/";
+			const uint32_t package = ReadSysUInt(cpuPath + "topology/physical_package_id", 0);
+			const uint32_t coreID = ReadSysUInt(cpuPath + "topology/core_id", cpu);
+
+			std::string l3 = FindL3SharedList(cpuPath);
+			if (l3.empty()) l3 = "package" + std::to_string(package);
+
+			LogicalProcessor processor{};
+			processor.Index = cpu;
+			processor.Package = package;
+			processor.PhysicalCore = cores.emplace(std::make_pair(package, coreID), (uint32_t)cores.size()).first->second;
+			processor.L3Group = l3Groups.emplace(l3, (uint32_t)l3Groups.size()).first->second;
+			processor.NUMANode = nodes.emplace(FindNUMANode(cpuPath), (uint32_t)nodes.size()).first->second;
+			topology.LogicalProcessors.push_back(processor);
+		}
+	}
+
+}
+
+#endif // __linux__
\ No newline at end of file
@@ -0,0 +1,42 @@
+#ifdef __linux__
+
+#include "LinuxCore.hpp"
+
+#include <cstring>
+#include <climits>
+#include <ctime>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+
+namespace Arcane {
+
+	Logger &GetLinuxLogger() {
+		static Logger logger("Arcane.Linux");
+		return logger;
+	}
+
+	std::string GetLinuxErrorMessageString(int errorCode) {
+		return std::string(strerror(errorCode));
+	}
+
+	bool FutexWait(std::atomic<uint32_t> *address, uint32_t expected, uint32_t millis) {
+		timespec timeout;
+		timespec *timeoutPointer = nullptr;
+
+		if (millis != UINT32_MAX) {
+			timeout.tv_sec = millis / 1000;
+			timeout.tv_nsec = (long)(millis % 1000) * 1000000;
+			timeoutPointer = &timeout;
+		}
+
+		long result = syscall(SYS_futex, (uint32_t*)address, FUTEX_WAIT_PRIVATE, expected, timeoutPointer, nullptr, 0);
+		return result == 0 || errno != ETIMEDOUT;
+	}
+
+	void FutexWake(std::atomic<uint32_t> *address, uint32_t count) {
+		syscall(SYS_futex, (uint32_t*)address, FUTEX_WAKE_PRIVATE, count > INT_MAX ? INT_MAX : (int)count, nullptr, nullptr, 0);
+	}
+
+}
+
+#endif // __linux__
\ No newline at end of file
@@ -0,0 +1,40 @@
+#pragma once
+
+#ifdef __linux__
+
+#include <Arcane/Core.hpp>
+
+#include <atomic>
+#include <cerrno>
+#include <unistd.h>
+
+#ifdef _DEBUG
+#	define AR_LINUX_ASSERT(x, ...) { if (!(x)) { ::Arcane::GetLinuxLogger().Log(LogLevel::Fatal, __VA_ARGS__); __builtin_trap(); } }
+#	define AR_LINUX_TRACE(...) ::Arcane::GetLinuxLogger().Log(Arcane::LogLevel::Trace, __VA_ARGS__)
+#	define AR_LINUX_INFO(...) ::Arcane::GetLinuxLogger().Log(Arcane::LogLevel::Info, __VA_ARGS__)
+#	define AR_LINUX_DEBUG(...) ::Arcane::GetLinuxLogger().Log(Arcane::LogLevel::Debug, __VA_ARGS__)
+#	define AR_LINUX_WARNING(...) ::Arcane::GetLinuxLogger().Log(Arcane::LogLevel::Warning, __VA_ARGS__)
+#	define AR_LINUX_ERROR(...) ::Arcane::GetLinuxLogger().Log(Arcane::LogLevel::Error, __VA_ARGS__)
+#	define AR_LINUX_FATAL(...) ::Arcane::GetLinuxLogger().Log(Arcane::LogLevel::Fatal, __VA_ARGS__)
+#else
+#	define AR_LINUX_ASSERT(x, ...)
+#	define AR_LINUX_TRACE(...)
+#	define AR_LINUX_INFO(...)
+#	define AR_LINUX_DEBUG(...)
+#	define AR_LINUX_WARNING(...)
+#	define AR_LINUX_ERROR(...)
+#	define AR_LINUX_FATAL(...)
+#endif
+
+namespace Arcane {
+
+	Logger &GetLinuxLogger();
+	std::string GetLinuxErrorMessageString(int errorCode);
+
+	// Blocks while *address still holds expected. Returns false on timeout.
+	bool FutexWait(std::atomic<uint32_t> *address, uint32_t expected, uint32_t millis = UINT32_MAX);
+	void FutexWake(std::atomic<uint32_t> *address, uint32_t count);
+
+}
+
+#endif // __linux__
\ No newline at end of file
@@ -0,0 +1,329 @@
+#ifdef __linux__
+
+#include <Arcane/Native/NativeFile.hpp>
+
+#include "LinuxCore.hpp"
+
+#include <Arcane/Math/Math.hpp>
+
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+
+namespace Arcane {
+
+	void *_MapFile(const char *path, uint32_t hints, size_t *size) {
+		AR_ASSERT(path != nullptr, "Path cannot be null");
+		*size = 0;
+
+		int fd = open(path, O_RDONLY | O_CLOEXEC);
+		if (fd < 0) return nullptr;
+
+		struct stat info;
+		if (fstat(fd, &info) != 0 || info.st_size == 0) {
+			close(fd);
+			return nullptr;
+		}
+
+		void *ptr = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		// The mapping keeps its own reference to the file.
+		close(fd);
+
+		if (ptr == MAP_FAILED) {
+			AR_LINUX_ERROR("Failed to map {}: {}", path, GetLinuxErrorMessageString(errno));
+			return nullptr;
+		}
+
+		// Hints only affect read-ahead, so failures are not fatal.
+		if (hints & FileAccessHint_Sequential) madvise(ptr, (size_t)info.st_size, MADV_SEQUENTIAL);
+		if (hints & FileAccessHint_Random) madvise(ptr, (size_t)info.st_size, MADV_RANDOM);
+		if (hints & FileAccessHint_WillNeed) madvise(ptr, (size_t)info.st_size, MADV_WILLNEED);
+
+		*size = (size_t)info.st_size;
+		return ptr;
+	}
+
+	void _UnmapFile(void *ptr, size_t size) {
+		AR_ASSERT(ptr != nullptr, "Cannot unmap null pointer");
+
+		[[maybe_unused]] int result = munmap(ptr, size);
+		AR_LINUX_ASSERT(result == 0, "Failed to unmap file: {}", GetLinuxErrorMessageString(errno));
+	}
+
+	FileHandle _OpenFile(const char *path, size_t *size) {
+		AR_ASSERT(path != nullptr, "Path cannot be null");
+		*size = 0;
+
+		int fd = open(path, O_RDONLY | O_CLOEXEC);
+		if (fd < 0) return AR_INVALID_FILE_HANDLE;
+
+		struct stat info;
+		if (fstat(fd, &info) != 0) {
+			close(fd);
+			return AR_INVALID_FILE_HANDLE;
+		}
+
+		*size = (size_t)info.st_size;
+		return (FileHandle)fd;
+	}
+
+	void _CloseFile(FileHandle file) {
+		AR_ASSERT(file != AR_INVALID_FILE_HANDLE, "Cannot close an invalid file");
+		close((int)file);
+	}
+
+	int64_t _ReadFileAt(FileHandle file, void *buffer, size_t size, uint64_t offset) {
+		size_t total = 0;
+		while (total < size) {
+			const ssize_t result = pread((int)file, (uint8_t*)buffer + total, size - total, (off_t)(offset + total));
+			if (result < 0 && errno == EINTR) continue;
+			if (result < 0) return -1;
+			if (result == 0) break;
+
+			total += (size_t)result;
+		}
+
+		return (int64_t)total;
+	}
+
+	// io_uring is used through its system calls directly, so there is no
+	// dependency on liburing. The rings are shared with the kernel; the
+	// head and tail indices are the only fields that need atomic access.
+	struct LinuxIORing {
+		int Fd;
+
+		void *SQRing;
+		size_t SQRingSize;
+		void *CQRing;
+		size_t CQRingSize;
+		io_uring_sqe *SQEs;
+		size_t SQEsSize;
+
+		uint32_t *SQHead;
+		uint32_t *SQTail;
+		uint32_t SQMask;
+		uint32_t SQEntries;
+		uint32_t *SQArray;
+		// Entries written to the ring but not yet passed to the kernel.
+		uint32_t Pending;
+
+		uint32_t *CQHead;
+		uint32_t *CQTail;
+		uint32_t CQMask;
+		io_uring_cqe *CQEs;
+	};
+
+	static inline uint32_t LoadAcquire(uint32_t *value) { return std::atomic_ref<uint32_t>(*value).load(std::memory_order_acquire); }
+	static inline void StoreRelease(uint32_t *value, uint32_t x) { std::atomic_ref<uint32_t>(*value).store(x, std::memory_order_release); }
+
+	static inline int IORingEnter(int fd, uint32_t submit, uint32_t wait, uint32_t flags) {
+		return (int)syscall(__NR_io_uring_enter, fd, submit, wait, flags, nullptr, 0);
+	}
+
+	void *_CreateIORing(uint32_t depth) {
+		io_uring_params params;
+		std::memset(&params, 0, sizeof(params));
+
+		const int fd = (int)syscall(__NR_io_uring_setup, depth, &params);
+		if (fd < 0) {
+			AR_LINUX_WARNING("io_uring is not available: {}", GetLinuxErrorMessageString(errno));
+			return nullptr;
+		}
+
+		// IORING_OP_READ arrived in the same kernel (5.6) as this feature
+		// flag, and older kernels have no way to probe for it.
+		if (!(params.features & IORING_FEAT_RW_CUR_POS)) {
+			AR_LINUX_WARNING("io_uring does not support plain reads on this kernel");
+			close(fd);
+			return nullptr;
+		}
+
+		LinuxIORing *ring = new LinuxIORing();
+		ring->Fd = fd;
+		ring->SQRingSize = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+		ring->CQRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+		ring->SQEsSize = params.sq_entries * sizeof(io_uring_sqe);
+
+		const bool singleMap = params.features & IORING_FEAT_SINGLE_MMAP;
+		if (singleMap) ring->SQRingSize = ring->CQRingSize = Max(ring->SQRingSize, ring->CQRingSize);
+
+		ring->SQRing = mmap(nullptr, ring->SQRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+		ring->CQRing = singleMap ? ring->SQRing : mmap(nullptr, ring->CQRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+		ring->SQEs = (io_uring_sqe*)mmap(nullptr, ring->SQEsSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+		AR_LINUX_ASSERT(ring->SQRing != MAP_FAILED && ring->CQRing != MAP_FAILED && ring->SQEs != MAP_FAILED, "Failed to map io_uring: {}", GetLinuxErrorMessageString(errno));
+
+		uint8_t *sq = (uint8_t*)ring->SQRing;
+		ring->SQHead = (uint32_t*)(sq + params.sq_off.head);
+		ring->SQTail = (uint32_t*)(sq + params.sq_off.tail);
+		ring->SQMask = *(uint32_t*)(sq + params.sq_off.ring_mask);
+		ring->SQEntries = *(uint32_t*)(sq + params.sq_off.ring_entries);
+		ring->SQArray = (uint32_t*)(sq + params.sq_off.array);
+		ring->Pending = 0;
+
+		uint8_t *cq = (uint8_t*)ring->CQRing;
+		ring->CQHead = (uint32_t*)(cq + params.cq_off.head);
+		ring->CQTail = (uint32_t*)(cq + params.cq_off.tail);
+		ring->CQMask = *(uint32_t*)(cq + params.cq_off.ring_mask);
+		ring->CQEs = (io_uring_cqe*)(cq + params.cq_off.cqes);
+
+		return ring;
+	}
+
+	void _DestroyIORing(void *ring) {
+		LinuxIORing *r = (LinuxIORing*)ring;
+
+		munmap(r->SQEs, r->SQEsSize);
+		if (r->CQRing != r->SQRing) munmap(r->CQRing, r->CQRingSize);
+		munmap(r->SQRing, r->SQRingSize);
+		close(r->Fd);
+
+		delete r;
+	}
+
+	static io_uring_sqe *GetSubmissionEntry(LinuxIORing *ring) {
+		const uint32_t tail = *ring->SQTail;
+		if (tail - LoadAcquire(ring->SQHead) >= ring->SQEntries) return nullptr;
+
+		const uint32_t index = tail & ring->SQMask;
+		io_uring_sqe *sqe = &ring->SQEs[index];
+		std::memset(sqe, 0, sizeof(io_uring_sqe));
+		ring->SQArray[index] = index;
+		return sqe;
+	}
+
+	static void PushSubmissionEntry(LinuxIORing *ring) {
+		StoreRelease(ring->SQTail, *ring->SQTail + 1);
+		ring->Pending++;
+	}
+
+	bool _QueueRead(void *ring, FileHandle file, void *buffer, size_t size, uint64_t offset, void *userData) {
+		AR_ASSERT(size <= UINT32_MAX, "Reads are limited to 4 GiB");
+		LinuxIORing *r = (LinuxIORing*)ring;
+
+		io_uring_sqe *sqe = GetSubmissionEntry(r);
+		if (sqe == nullptr) return false;
+
+		sqe->opcode = IORING_OP_READ;
+		sqe->fd = (int)file;
+		sqe->addr = (uint64_t)(uintptr_t)buffer;
+		sqe->len = (uint32_t)size;
+		sqe->off = offset;
+		sqe->user_data = (uint64_t)(uintptr_t)userData;
+
+		PushSubmissionEntry(r);
+		return true;
+	}
+
+	bool _QueueWake(void *ring) {
+		LinuxIORing *r = (LinuxIORing*)ring;
+
+		io_uring_sqe *sqe = GetSubmissionEntry(r);
+		if (sqe == nullptr) return false;
+
+		sqe->opcode = IORING_OP_NOP;
+		sqe->user_data = 0;
+
+		PushSubmissionEntry(r);
+		return true;
+	}
+
+	void _SubmitIORing(void *ring) {
+		LinuxIORing *r = (LinuxIORing*)ring;
+
+		// One system call for everything queued since the last submit.
+		while (r->Pending > 0) {
+			const int result = IORingEnter(r->Fd, r->Pending, 0, 0);
+			if (result < 0 && (errno == EINTR || errno == EAGAIN || errno == EBUSY)) continue;
+			AR_LINUX_ASSERT(result >= 0, "Failed to submit to io_uring: {}", GetLinuxErrorMessageString(errno));
+			if (result < 0) return;
+
+			r->Pending -= (uint32_t)result;
+		}
+	}
+
+	uint32_t _WaitIORing(void *ring, IOCompletion *completions, uint32_t max) {
+		LinuxIORing *r = (LinuxIORing*)ring;
+
+		while (true) {
+			const uint32_t head = *r->CQHead;
+			const uint32_t tail = LoadAcquire(r->CQTail);
+
+			if (head != tail) {
+				const uint32_t count = Min(tail - head, max);
+				for (uint32_t i = 0; i < count; i++) {
+					const io_uring_cqe &cqe = r->CQEs[(head + i) & r->CQMask];
+					completions[i].UserData = (void*)(uintptr_t)cqe.user_data;
+					completions[i].Result = cqe.res;
+				}
+
+				StoreRelease(r->CQHead, head + count);
+				return count;
+			}
+
+			[[maybe_unused]] const int result = IORingEnter(r->Fd, 0, 1, IORING_ENTER_GETEVENTS);
+			AR_LINUX_ASSERT(result >= 0 || errno == EINTR, "Failed to wait on io_uring: {}", GetLinuxErrorMessageString(errno));
+		}
+	}
+
+	// The watcher is the inotify descriptor itself, offset by one so that
+	// it is never null.
+	void *_CreateDirectoryWatcher() {
+		const int fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+		AR_LINUX_ASSERT(fd >= 0, "Failed to create inotify instance: {}", GetLinuxErrorMessageString(errno));
+		return (void*)(intptr_t)(fd + 1);
+	}
+
+	void _DestroyDirectoryWatcher(void *watcher) {
+		close((int)(intptr_t)watcher - 1);
+	}
+
+	uint32_t _WatchDirectory(void *watcher, const char *path) {
+		AR_ASSERT(path != nullptr, "Path cannot be null");
+
+		// Editors often save by writing a temporary file and renaming it
+		// over the original, which only shows up as a move.
+		const int wd = inotify_add_watch((int)(intptr_t)watcher - 1, path, IN_CLOSE_WRITE | IN_MOVED_TO | IN_ONLYDIR);
+		if (wd < 0) {
+			AR_LINUX_ERROR("Failed to watch {}: {}", path, GetLinuxErrorMessageString(errno));
+			return UINT32_MAX;
+		}
+
+		return (uint32_t)wd;
+	}
+
+	bool _ReadDirectoryChanges(void *watcher, uint32_t millis, DirectoryChangeFunc func, void *userData) {
+		const int fd = (int)(intptr_t)watcher - 1;
+
+		pollfd request = { fd, POLLIN, 0 };
+		const int ready = poll(&request, 1, millis > INT32_MAX ? -1 : (int)millis);
+		if (ready <= 0) return false;
+
+		alignas(inotify_event) char buffer[4096];
+		bool changed = false;
+
+		while (true) {
+			const ssize_t length = read(fd, buffer, sizeof(buffer));
+			if (length <= 0) break;
+
+			for (ssize_t offset = 0; offset < length;) {
+				const inotify_event *event = (const inotify_event*)(buffer + offset);
+				offset += sizeof(inotify_event) + event->len;
+
+				if (event->mask & IN_Q_OVERFLOW) AR_LINUX_WARNING("inotify queue overflowed, file changes were lost");
+				if (event->len == 0 || (event->mask & IN_ISDIR)) continue;
+
+				func((uint32_t)event->wd, event->name, userData);
+				changed = true;
+			}
+		}
+
+		return changed;
+	}
+
+}
+
+#endif // __linux__
\ No newline at end of file
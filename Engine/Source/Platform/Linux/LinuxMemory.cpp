@@ -0,0 +1,143 @@
+#ifdef __linux__
+
+#include <Arcane/Native/NativeMemory.hpp>
+
+#include "LinuxCore.hpp"
+
+#include <malloc.h>
+#include <sys/mman.h>
+
+#define AR_LINUX_HUGE_PAGE_SIZE (2 * 1024 * 1024)
+
+namespace Arcane {
+
+	void *_Allocate(size_t size) {
+		AR_ASSERT(size > 0, "Cannot allocate zero bytes");
+
+		void *ptr = calloc(1, size);
+		AR_LINUX_ASSERT(ptr != nullptr, "Failed to allocate memory: {}", GetLinuxErrorMessageString(errno));
+
+		AR_PROFILE_ALLOC(ptr, size);
+
+		return ptr;
+	}
+
+	void *_ReAllocate(void *ptr, size_t size) {
+		AR_ASSERT(size > 0, "Cannot reallocate to zero bytes");
+
+		// Grown memory is zeroed to match _Allocate() and the Windows heap.
+		const size_t oldSize = ptr != nullptr ? malloc_usable_size(ptr) : 0;
+
+		void *newPtr = realloc(ptr, size);
+		AR_LINUX_ASSERT(newPtr != nullptr, "Failed to reallocate memory: {}", GetLinuxErrorMessageString(errno));
+
+		if (size > oldSize) std::memset((uint8_t*)newPtr + oldSize, 0, size - oldSize);
+
+		AR_PROFILE_FREE(ptr);
+		AR_PROFILE_ALLOC(newPtr, size);
+
+		return newPtr;
+	}
+
+	void _Free(void *ptr) {
+		AR_ASSERT(ptr != nullptr, "Cannot free null pointer");
+
+		free(ptr);
+
+		AR_PROFILE_FREE(ptr);
+	}
+
+	void *_CopyMemory(void *dest, const void *src, size_t size) {
+		AR_ASSERT(dest != nullptr && src != nullptr, "Cannot copy memory to/from null pointer");
+		AR_ASSERT(size > 0, "Cannot copy zero bytes");
+
+		return std::memcpy(dest, src, size);
+	}
+
+	void *_MoveMemory(void *dest, void *src, size_t size) {
+		AR_ASSERT(dest != nullptr && src != nullptr, "Cannot move memory to/from null pointer");
+		AR_ASSERT(size > 0, "Cannot move zero bytes");
+
+		return std::memmove(dest, src, size);
+	}
+
+	void *_SetMemory(void *ptr, int value, size_t size) {
+		AR_ASSERT(ptr != nullptr, "Cannot set memory of null pointer");
+		AR_ASSERT(size > 0, "Cannot set zero bytes");
+
+		return std::memset(ptr, value, size);
+	}
+
+	size_t _GetPageSize() {
+		static const size_t pageSize = (size_t)sysconf(_SC_PAGESIZE);
+		return pageSize;
+	}
+
+	void *_ReserveVirtual(size_t size, uint32_t flags) {
+		AR_ASSERT(size > 0, "Cannot reserve zero bytes");
+
+		const size_t pageSize = _GetPageSize();
+		size = (size + pageSize - 1) & ~(pageSize - 1);
+
+		if (!(flags & VirtualMemoryFlag_HugePages)) {
+			void *ptr = mmap(nullptr, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+			AR_LINUX_ASSERT(ptr != MAP_FAILED, "Failed to reserve virtual memory: {}", GetLinuxErrorMessageString(errno));
+			return ptr;
+		}
+
+		// Transparent huge pages are only used for 2 MB aligned ranges, so
+		// reserve extra space and cut off whatever lies outside the aligned part.
+		const size_t paddedSize = size + AR_LINUX_HUGE_PAGE_SIZE;
+		uint8_t *base = (uint8_t*)mmap(nullptr, paddedSize, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+		AR_LINUX_ASSERT(base != MAP_FAILED, "Failed to reserve virtual memory: {}", GetLinuxErrorMessageString(errno));
+
+		uint8_t *ptr = (uint8_t*)(((uintptr_t)base + AR_LINUX_HUGE_PAGE_SIZE - 1) & ~(uintptr_t)(AR_LINUX_HUGE_PAGE_SIZE - 1));
+		if (ptr > base) munmap(base, ptr - base);
+		if (base + paddedSize > ptr + size) munmap(ptr + size, (base + paddedSize) - (ptr + size));
+
+		if (madvise(ptr, size, MADV_HUGEPAGE) != 0) {
+			AR_LINUX_WARNING("Transparent huge pages are not available: {}", GetLinuxErrorMessageString(errno));
+		}
+
+		return ptr;
+	}
+
+	void _ReleaseVirtual(void *ptr, size_t size) {
+		AR_ASSERT(ptr != nullptr, "Cannot release null pointer");
+
+		const size_t pageSize = _GetPageSize();
+		[[maybe_unused]] int result = munmap(ptr, (size + pageSize - 1) & ~(pageSize - 1));
+		AR_LINUX_ASSERT(result == 0, "Failed to release virtual memory: {}", GetLinuxErrorMessageString(errno));
+	}
+
+	void _CommitVirtual(void *ptr, size_t size) {
+		AR_ASSERT(ptr != nullptr, "Cannot commit null pointer");
+		if (size == 0) return;
+
+		// Physical pages are only assigned once they are first touched.
+		const size_t pageSize = _GetPageSize();
+		const uintptr_t begin = (uintptr_t)ptr & ~(uintptr_t)(pageSize - 1);
+		const uintptr_t end = ((uintptr_t)ptr + size + pageSize - 1) & ~(uintptr_t)(pageSize - 1);
+
+		[[maybe_unused]] int result = mprotect((void*)begin, end - begin, PROT_READ | PROT_WRITE);
+		AR_LINUX_ASSERT(result == 0, "Failed to commit virtual memory: {}", GetLinuxErrorMessageString(errno));
+	}
+
+	void _DecommitVirtual(void *ptr, size_t size) {
+		AR_ASSERT(ptr != nullptr, "Cannot decommit null pointer");
+
+		const size_t pageSize = _GetPageSize();
+		const uintptr_t begin = ((uintptr_t)ptr + pageSize - 1) & ~(uintptr_t)(pageSize - 1);
+		const uintptr_t end = ((uintptr_t)ptr + size) & ~(uintptr_t)(pageSize - 1);
+		if (end <= begin) return;
+
+		[[maybe_unused]] int result = madvise((void*)begin, end - begin, MADV_DONTNEED);
+		AR_LINUX_ASSERT(result == 0, "Failed to decommit virtual memory: {}", GetLinuxErrorMessageString(errno));
+
+		result = mprotect((void*)begin, end - begin, PROT_NONE);
+		AR_LINUX_ASSERT(result == 0, "Failed to decommit virtual memory: {}", GetLinuxErrorMessageString(errno));
+	}
+
+}
+
+#endif // __linux__
\ No newline at end of file
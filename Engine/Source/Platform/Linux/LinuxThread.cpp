@@ -0,0 +1,293 @@
+#ifdef __linux__
+
+#include "LinuxThread.hpp"
+
+#include <ctime>
+#include <sched.h>
+#include <sys/syscall.h>
+
+#define AR_LINUX_MUTEX_SPIN_COUNT 100
+#define AR_LINUX_SEMAPHORE_SPIN_COUNT 100
+
+namespace Arcane {
+
+	static thread_local LinuxThreadState *sCurrentState = nullptr;
+	static thread_local Ref<NativeThread> sCurrentThread;
+
+	static ThreadID GetCurrentThreadID() {
+		return (ThreadID)syscall(SYS_gettid);
+	}
+
+	static cpu_set_t ToCPUSet(const CPUSet &cpus) {
+		cpu_set_t result;
+		CPU_ZERO(&result);
+		for (uint32_t i = 0; i < AR_MAX_CPUS && i < CPU_SETSIZE; i++) {
+			if (cpus.test(i)) CPU_SET(i, &result);
+		}
+		return result;
+	}
+
+	static void ReleaseThreadState(LinuxThreadState *state) {
+		if (state->References.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+			delete state;
+		}
+	}
+
+	// Drops the thread's reference to its state however it ends. Exit()
+	// and Terminate() do not return through LinuxThreadEntry, but both
+	// unwind it, which runs this destructor.
+	struct LinuxThreadStateGuard {
+		~LinuxThreadStateGuard() {
+			LinuxThreadState *state = sCurrentState;
+			sCurrentState = nullptr;
+			if (state) ReleaseThreadState(state);
+		}
+	};
+
+	static void *LinuxThreadEntry(void *data) {
+		LinuxThreadState *state = (LinuxThreadState*)data;
+		sCurrentState = state;
+		LinuxThreadStateGuard guard;
+
+		state->ID.store(GetCurrentThreadID(), std::memory_order_release);
+		FutexWake(&state->ID, UINT32_MAX);
+
+		const int32_t code = state->Func(state->Data);
+		state->ExitCode.store(code, std::memory_order_release);
+		return nullptr;
+	}
+
+	void NativeThread::Switch() {
+		sched_yield();
+	}
+
+	Ref<NativeThread> NativeThread::GetCurrent() {
+		if (!sCurrentThread) {
+			sCurrentThread = CastRef<NativeThread>(CreateRef<LinuxThread>(
+				pthread_self(),
+				GetCurrentThreadID()
+			));
+		}
+		return sCurrentThread;
+	}
+
+	void NativeThread::Exit(int32_t code) {
+		LinuxThreadState *state = sCurrentState;
+		if (state) state->ExitCode.store(code, std::memory_order_release);
+		pthread_exit(nullptr);
+	}
+
+	void NativeThread::Await(const Ref<NativeThread> &thread, uint32_t seconds) {
+		Ref<LinuxThread> linuxThread = CastRef<LinuxThread>(thread);
+		if (!linuxThread->mStarted) return;
+
+		if (seconds == UINT32_MAX) {
+			if (linuxThread->mJoined.exchange(true)) return;
+			pthread_join(linuxThread->mThread, nullptr);
+			return;
+		}
+
+		timespec deadline;
+		clock_gettime(CLOCK_REALTIME, &deadline);
+		deadline.tv_sec += seconds / 1000;
+		deadline.tv_nsec += (long)(seconds % 1000) * 1000000;
+		if (deadline.tv_nsec >= 1000000000) {
+			deadline.tv_sec++;
+			deadline.tv_nsec -= 1000000000;
+		}
+
+		if (linuxThread->mJoined.load()) return;
+		if (pthread_timedjoin_np(linuxThread->mThread, nullptr, &deadline) == 0) {
+			linuxThread->mJoined.store(true);
+		}
+	}
+
+	void NativeThread::Sleep(uint32_t millis) {
+		timespec duration;
+		duration.tv_sec = millis / 1000;
+		duration.tv_nsec = (long)(millis % 1000) * 1000000;
+		while (nanosleep(&duration, &duration) == -1 && errno == EINTR) { }
+	}
+
+	LinuxMutex::LinuxMutex() : mState(0) { }
+
+	LinuxMutex::~LinuxMutex() {
+		AR_LINUX_ASSERT(mState.load() == 0, "Destroying a locked mutex");
+	}
+
+	void LinuxMutex::Lock() {
+		uint32_t expected = 0;
+		if (mState.compare_exchange_strong(expected, 1, std::memory_order_acquire, std::memory_order_relaxed)) return;
+		LockSlow();
+	}
+
+	void LinuxMutex::LockSlow() {
+		for (uint32_t i = 0; i < AR_LINUX_MUTEX_SPIN_COUNT; i++) {
+			uint32_t expected = 0;
+			if (mState.load(std::memory_order_relaxed) == 0 &&
+				mState.compare_exchange_weak(expected, 1, std::memory_order_acquire, std::memory_order_relaxed)) {
+				return;
+			}
+			AR_CPU_PAUSE();
+		}
+
+		// Mark the lock as contended so the owner knows to wake us on unlock.
+		while (mState.exchange(2, std::memory_order_acquire) != 0) {
+			FutexWait(&mState, 2);
+		}
+	}
+
+	void LinuxMutex::Unlock() {
+		if (mState.exchange(0, std::memory_order_release) == 2) {
+			FutexWake(&mState, 1);
+		}
+	}
+
+	LinuxConditionVariable::LinuxConditionVariable() : mSequence(0) { }
+
+	LinuxConditionVariable::~LinuxConditionVariable() { }
+
+	void LinuxConditionVariable::Wait(const Ref<NativeMutex> &mutex) {
+		Ref<NativeMutex> nativeMutex = mutex;
+		const uint32_t sequence = mSequence.load(std::memory_order_acquire);
+		nativeMutex->Unlock();
+		FutexWait(&mSequence, sequence);
+		nativeMutex->Lock();
+	}
+
+	bool LinuxConditionVariable::Wait(const Ref<NativeMutex> &mutex, uint32_t millis) {
+		Ref<NativeMutex> nativeMutex = mutex;
+		const uint32_t sequence = mSequence.load(std::memory_order_acquire);
+		nativeMutex->Unlock();
+		const bool woken = FutexWait(&mSequence, sequence, millis);
+		nativeMutex->Lock();
+		return woken;
+	}
+
+	void LinuxConditionVariable::NotifyOne() {
+		mSequence.fetch_add(1, std::memory_order_release);
+		FutexWake(&mSequence, 1);
+	}
+
+	void LinuxConditionVariable::NotifyAll() {
+		mSequence.fetch_add(1, std::memory_order_release);
+		FutexWake(&mSequence, UINT32_MAX);
+	}
+
+	LinuxSemaphore::LinuxSemaphore(uint32_t count) : mCount(count), mWaiters(0) { }
+
+	LinuxSemaphore::~LinuxSemaphore() { }
+
+	bool LinuxSemaphore::TryWait() {
+		uint32_t count = mCount.load(std::memory_order_relaxed);
+		while (count > 0) {
+			if (mCount.compare_exchange_weak(count, count - 1, std::memory_order_acquire, std::memory_order_relaxed)) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	void LinuxSemaphore::Wait() {
+		for (uint32_t i = 0; i < AR_LINUX_SEMAPHORE_SPIN_COUNT; i++) {
+			if (TryWait()) return;
+			AR_CPU_PAUSE();
+		}
+
+		mWaiters.fetch_add(1, std::memory_order_seq_cst);
+		while (!TryWait()) {
+			FutexWait(&mCount, 0);
+		}
+		mWaiters.fetch_sub(1, std::memory_order_relaxed);
+	}
+
+	void LinuxSemaphore::Post(uint32_t count) {
+		mCount.fetch_add(count, std::memory_order_seq_cst);
+		if (mWaiters.load(std::memory_order_seq_cst) > 0) {
+			FutexWake(&mCount, count);
+		}
+	}
+
+	LinuxThread::LinuxThread(ThreadFunc func, void *data) : mThread(0), mID(0), mStarted(false), mJoined(false) {
+		mState = new LinuxThreadState();
+		mState->Func = func;
+		mState->Data = data;
+		mState->ID.store(0);
+		mState->ExitCode.store(0);
+		mState->References.store(1);
+	}
+
+	LinuxThread::LinuxThread(pthread_t thread, ThreadID id) : mThread(thread), mState(nullptr), mID(id), mStarted(true), mJoined(true) { }
+
+	LinuxThread::~LinuxThread() {
+		if (!mState) return;
+		if (mStarted && !mJoined.exchange(true)) {
+			pthread_detach(mThread);
+		}
+		ReleaseThreadState(mState);
+	}
+
+	void LinuxThread::Start() {
+		if (mStarted) return;
+
+		mState->References.fetch_add(1, std::memory_order_relaxed);
+		pthread_attr_t attributes;
+		pthread_attr_init(&attributes);
+		if (mAffinity.any()) {
+			cpu_set_t cpus = ToCPUSet(mAffinity);
+			pthread_attr_setaffinity_np(&attributes, sizeof(cpu_set_t), &cpus);
+		}
+
+		int result = pthread_create(&mThread, &attributes, LinuxThreadEntry, mState);
+		pthread_attr_destroy(&attributes);
+		AR_LINUX_ASSERT(result == 0, "Failed to create thread: {}", GetLinuxErrorMessageString(result));
+		if (result != 0) {
+			ReleaseThreadState(mState);
+			return;
+		}
+		mStarted = true;
+
+		// Wait for the thread to publish its kernel ID so GetID() is valid
+		// as soon as Start() returns, like a resumed Windows thread.
+		while (mState->ID.load(std::memory_order_acquire) == 0) {
+			FutexWait(&mState->ID, 0);
+		}
+		mID = mState->ID.load(std::memory_order_relaxed);
+	}
+
+	void LinuxThread::Suspend() {
+		AR_LINUX_WARNING("Suspending a running thread is not supported on Linux");
+	}
+
+	void LinuxThread::Terminate(int32_t code) {
+		if (!mStarted || mJoined.load()) return;
+		mState->ExitCode.store(code, std::memory_order_release);
+		pthread_cancel(mThread);
+	}
+
+	void LinuxThread::SetAffinity(const CPUSet &cpus) {
+		if (cpus.none()) return;
+
+		// Threads that have not been started yet get their affinity applied
+		// at creation, so they never run on the wrong core.
+		if (!mStarted) {
+			mAffinity = cpus;
+			return;
+		}
+
+		cpu_set_t set = ToCPUSet(cpus);
+		[[maybe_unused]] int result = pthread_setaffinity_np(mThread, sizeof(cpu_set_t), &set);
+		AR_LINUX_ASSERT(result == 0, "Failed to set thread affinity: {}", GetLinuxErrorMessageString(result));
+	}
+
+	int32_t LinuxThread::GetExitCode() const {
+		return mState ? mState->ExitCode.load(std::memory_order_acquire) : 0;
+	}
+
+	ThreadID LinuxThread::GetID() const {
+		return mID;
+	}
+
+}
+
+#endif // __linux__
\ No newline at end of file
@@ -0,0 +1,96 @@
+#pragma once
+
+#ifdef __linux__
+
+#include <Arcane/Core.hpp>
+#include <Arcane/Native/NativeThread.hpp>
+#include "LinuxCore.hpp"
+
+#include <pthread.h>
+
+namespace Arcane {
+
+	// Three-state futex lock (0 = unlocked, 1 = locked, 2 = locked with
+	// waiters). An uncontended lock/unlock is a single CAS and a single
+	// exchange; contended lockers spin briefly before parking in the kernel.
+	class LinuxMutex : public NativeMutex {
+	public:
+		LinuxMutex();
+		~LinuxMutex();
+
+		virtual void Lock() override;
+		virtual void Unlock() override;
+
+	private:
+		void LockSlow();
+
+	private:
+		std::atomic<uint32_t> mState;
+	};
+
+	class LinuxConditionVariable : public NativeConditionVariable {
+	public:
+		LinuxConditionVariable();
+		~LinuxConditionVariable();
+
+		virtual void Wait(const Ref<NativeMutex> &mutex) override;
+		virtual bool Wait(const Ref<NativeMutex> &mutex, uint32_t millis) override;
+		virtual void NotifyOne() override;
+		virtual void NotifyAll() override;
+
+	private:
+		std::atomic<uint32_t> mSequence;
+	};
+
+	class LinuxSemaphore : public NativeSemaphore {
+	public:
+		LinuxSemaphore(uint32_t count);
+		~LinuxSemaphore();
+
+		virtual void Wait() override;
+		virtual bool TryWait() override;
+		virtual void Post(uint32_t count) override;
+
+	private:
+		std::atomic<uint32_t> mCount;
+		std::atomic<uint32_t> mWaiters;
+	};
+
+	// State shared between a LinuxThread and the thread it runs, so either
+	// side can go away first.
+	struct LinuxThreadState {
+		ThreadFunc *Func;
+		void *Data;
+		std::atomic<uint32_t> ID;
+		std::atomic<int32_t> ExitCode;
+		std::atomic<uint32_t> References;
+	};
+
+	class LinuxThread : public NativeThread {
+	friend class NativeThread;
+	public:
+		LinuxThread(ThreadFunc func, void *data);
+		LinuxThread(pthread_t thread, ThreadID id);
+		~LinuxThread();
+
+		virtual void Start() override;
+		virtual void Suspend() override;
+		virtual void Terminate(int32_t code) override;
+		virtual void SetAffinity(const CPUSet &cpus) override;
+		virtual int32_t GetExitCode() const override;
+		virtual ThreadID GetID() const override;
+
+		inline pthread_t GetHandle() const { return mThread; }
+
+	private:
+		pthread_t mThread;
+		LinuxThreadState *mState;
+		ThreadID mID;
+		CPUSet mAffinity;
+		bool mStarted;
+		std::atomic<bool> mJoined;
+	};
+
+}
+
+#endif // __linux__
\ No newline at end of file
@@ -0,0 +1,25 @@
+#ifdef __linux__
+
+#include <Arcane/Native/NativeTime.hpp>
+
+#include <ctime>
+
+namespace Arcane {
+
+	uint64_t _GetCurrentTimeMillis() {
+		timespec time;
+		clock_gettime(CLOCK_MONOTONIC, &time);
+
+		return (uint64_t)time.tv_sec * 1000 + (uint64_t)time.tv_nsec / 1000000;
+	}
+
+	uint64_t _GetCurrentTimeMicros() {
+		timespec time;
+		clock_gettime(CLOCK_MONOTONIC, &time);
+
+		return (uint64_t)time.tv_sec * 1000000 + (uint64_t)time.tv_nsec / 1000;
+	}
+
+}
+
+#endif // __linux__
\ No newline at end of file
@@ -1,5 +1,7 @@
 #include "OpenGLFramebuffer.hpp"
 
+#include <Arcane/System/Memory.hpp>
+
 namespace Arcane {
 
 	OpenGLFramebuffer::OpenGLFramebuffer(const Ref<OpenGLGraphicsContext> &context, const FramebufferInfo &info) : mContext(context), mWidth(info.Width), mHeight(info.Height), mSamples(info.Samples), mFixedSampleLocations(info.FixedSampleLocations), mAttachmentCount(info.AttachmentCount) {
@@ -99,6 +101,9 @@ namespace Arcane {
 		AR_PROFILE_FUNCTION_GPU_CPU();
 		if (mWidth == width && mHeight == height) return;
 
+		// Only happens when the window changes size.
+		UncheckedAllocationScope unchecked;
+
 		mWidth = width;
 		mHeight = height;
 		
@@ -16,6 +16,8 @@ namespace Arcane {
 		~OpenGLGraphicsContext();
 
 		virtual void Present() override;
+		virtual void MakeCurrent() override;
+		virtual void ReleaseCurrent() override;
 
 		virtual uint32_t GetVersionMajor() const override { return mMajorVersion; }
 		virtual uint32_t GetVersionMinor() const override { return mMinorVersion; }
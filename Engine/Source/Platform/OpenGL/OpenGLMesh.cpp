@@ -50,20 +50,24 @@ namespace Arcane {
 
 		glVertexArrayVertexBuffer(mVertexArray, index, buffer->GetOpenGLID(), offset, stride);
 
+		const SmallVector<InputElement, AR_INPUT_LAYOUT_INLINE_ELEMENTS> &elements = layout.GetElements();
+
 		size_t relativeOffset = 0;
-		for (size_t i = 0; i < layout.GetElements().size(); i++) {
+		for (size_t i = 0; i < elements.GetSize(); i++) {
+			const InputElement &element = elements[i];
+
 			glEnableVertexArrayAttrib(mVertexArray, index + i);
 			glVertexArrayAttribFormat(
 				mVertexArray, 
 				index + i, 
-				GetInputElementTypeCount(layout.GetElements()[i]), 
-				GetInputElementOpenGLType(layout.GetElements()[i]), 
-				layout.GetElements()[i].Normalize ? GL_TRUE : GL_FALSE, 
+				GetInputElementTypeCount(element), 
+				GetInputElementOpenGLType(element), 
+				element.Normalize ? GL_TRUE : GL_FALSE, 
 				relativeOffset
 			);
 			glVertexArrayAttribBinding(mVertexArray, index + i, index);
 
-			relativeOffset += GetInputElementSize(layout.GetElements()[i]);
+			relativeOffset += GetInputElementSize(element);
 		}
 
 		mLayout.Append(layout);
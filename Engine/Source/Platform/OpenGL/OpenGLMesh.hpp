@@ -7,6 +7,8 @@
 #include "OpenGLGraphicsContext.hpp"
 #include "OpenGLBuffer.hpp"
 
+#include <vector>
+
 namespace Arcane {
 
 	class OpenGLMesh : public NativeMesh {
@@ -19,7 +21,7 @@ namespace Arcane {
 		virtual Ref<NativeBuffer> GetVertexBuffer(uint32_t index) override;
 		virtual Ref<NativeBuffer> GetIndexBuffer() override;
 
-		inline virtual InputLayout GetLayout() const override { return mLayout; }	
+		inline virtual const InputLayout &GetLayout() const override { return mLayout; }	
 
 		inline GLuint GetVertexArray() const { return mVertexArray; }
 
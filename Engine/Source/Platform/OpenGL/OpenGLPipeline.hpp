@@ -35,7 +35,7 @@ namespace Arcane {
 		inline virtual WindingOrder GetWindingOrder() const override { return mWindingOrder; }
 		inline virtual FillMode GetFillMode() const override { return mFillMode; }
 		inline virtual PrimitiveTopology GetTopology() const override { return mTopology; }
-		inline virtual InputLayout GetLayout() const override { return mLayout; }
+		inline virtual const InputLayout &GetLayout() const override { return mLayout; }
 		inline virtual uint32_t GetSampleCount() const override { return mSampleCount; }
 		inline virtual uint8_t GetOutputMask() const override { return mOutputMask; }
 		inline virtual float GetLineWidth() const override { return mLineWidth; }
@@ -199,5 +199,16 @@ namespace Arcane {
 		AR_PROFILE_GPU_COLLECT();
 	}
 
+	void OpenGLGraphicsContext::MakeCurrent() {
+		BOOL result = wglMakeCurrent(mDeviceContext, mRenderContext);
+		AR_WINDOWS_ASSERT(result, "Failed to make OpenGL context current: {}", GetWindowsErrorMessageString(GetLastError()));
+	}
+
+	void OpenGLGraphicsContext::ReleaseCurrent() {
+		if (wglGetCurrentContext() == mRenderContext) {
+			wglMakeCurrent(mDeviceContext, NULL);
+		}
+	}
+
 }
 #endif
\ No newline at end of file
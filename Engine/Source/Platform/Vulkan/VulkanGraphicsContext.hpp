@@ -14,6 +14,8 @@ namespace Arcane {
 		~VulkanGraphicsContext();
 
 		virtual void Present() override;
+		virtual void MakeCurrent() override { }
+		virtual void ReleaseCurrent() override { }
 		virtual uint32_t GetVersionMajor() const { return 1; }
 		virtual uint32_t GetVersionMinor() const { return 3;}
 		virtual uint32_t GetPatchLevel() const { return 0; }
@@ -100,12 +100,12 @@ namespace Arcane {
 		vertexInputBinding.stride = info.Layout.GetTotalSize();
 		vertexInputBinding.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
 
-		VkVertexInputAttributeDescription *vertexAttributes = new VkVertexInputAttributeDescription[info.Layout.GetElements().size()];
+		VkVertexInputAttributeDescription *vertexAttributes = new VkVertexInputAttributeDescription[info.Layout.GetElements().GetSize()];
 		
 		size_t offset = 0;
 		uint32_t index = 0;
 		
-		for (size_t i = 0; i < info.Layout.GetElements().size(); i++) {
+		for (size_t i = 0; i < info.Layout.GetElements().GetSize(); i++) {
 			const InputElement &element = info.Layout.GetElements()[i];
 			
 			for (uint32_t j = 0; j < element.Count; j++) {
@@ -124,7 +124,7 @@ namespace Arcane {
 		vertexInputInfo.flags = 0;
 		vertexInputInfo.vertexBindingDescriptionCount = 1;
 		vertexInputInfo.pVertexBindingDescriptions = &vertexInputBinding;
-		vertexInputInfo.vertexAttributeDescriptionCount = info.Layout.GetElements().size();
+		vertexInputInfo.vertexAttributeDescriptionCount = info.Layout.GetElements().GetSize();
 		vertexInputInfo.pVertexAttributeDescriptions = vertexAttributes;
 
 		VkPipelineInputAssemblyStateCreateInfo inputAssemblyInfo{};
@@ -29,7 +29,7 @@ namespace Arcane {
 		virtual WindingOrder GetWindingOrder() const override { return mWindingOrder; }
 		virtual FillMode GetFillMode() const override { return mFillMode; }
 		virtual PrimitiveTopology GetTopology() const override { return mTopology; }
-		virtual InputLayout GetLayout() const override { return mLayout; }
+		virtual const InputLayout &GetLayout() const override { return mLayout; }
 		virtual Rect2D GetViewport() const override { return mViewport; }
 		virtual Rect2D GetScissor() const override { return mScissor; }
 		virtual float GetPolygonOffsetFactor() const override { return mPolygonOffsetFactor; }
@@ -0,0 +1,72 @@
+#include <Arcane/Native/NativeCPU.hpp>
+#include "WindowsCore.hpp"
+
+#include <vector>
+
+namespace Arcane {
+
+	static uint32_t FindMaskIndex(const std::vector<KAFFINITY> &masks, uint32_t processor) {
+		for (uint32_t i = 0; i < masks.size(); i++) {
+			if (masks[i] & (((KAFFINITY)1) << processor)) return i;
+		}
+		return 0;
+	}
+
+	// Only processor group 0 is queried, which covers up to 64 logical
+	// processors.
+	void _QueryCPUTopology(CPUTopology &topology) {
+		DWORD length = 0;
+		GetLogicalProcessorInformationEx(RelationAll, nullptr, &length);
+
+		std::vector<uint8_t> buffer(length);
+		if (!GetLogicalProcessorInformationEx(RelationAll, (PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX)buffer.data(), &length)) {
+			AR_WINDOWS_ERROR("Failed to query processor topology: {}", GetWindowsErrorMessageString(GetLastError()));
+			return;
+		}
+
+		std::vector<KAFFINITY> cores;
+		std::vector<KAFFINITY> packages;
+		std::vector<KAFFINITY> l3Caches;
+		std::vector<KAFFINITY> nodes;
+
+		for (DWORD offset = 0; offset < length;) {
+			PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX info = (PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX)(buffer.data() + offset);
+
+			switch (info->Relationship) {
+			case RelationProcessorCore:
+				if (info->Processor.GroupMask[0].Group == 0) cores.push_back(info->Processor.GroupMask[0].Mask);
+				break;
+			case RelationProcessorPackage:
+				for (WORD i = 0; i < info->Processor.GroupCount; i++) {
+					if (info->Processor.GroupMask[i].Group == 0) packages.push_back(info->Processor.GroupMask[i].Mask);
+				}
+				break;
+			case RelationCache:
+				if (info->Cache.Level == 3 && info->Cache.GroupMask.Group == 0) l3Caches.push_back(info->Cache.GroupMask.Mask);
+				break;
+			case RelationNumaNode:
+				if (info->NumaNode.GroupMask.Group == 0) nodes.push_back(info->NumaNode.GroupMask.Mask);
+				break;
+			default:
+				break;
+			}
+
+			offset += info->Size;
+		}
+
+		for (uint32_t core = 0; core < cores.size(); core++) {
+			for (uint32_t i = 0; i < sizeof(KAFFINITY) * 8; i++) {
+				if (!(cores[core] & (((KAFFINITY)1) << i))) continue;
+
+				LogicalProcessor processor{};
+				processor.Index = i;
+				processor.PhysicalCore = core;
+				processor.Package = FindMaskIndex(packages, i);
+				processor.NUMANode = FindMaskIndex(nodes, i);
+				processor.L3Group = l3Caches.empty() ? processor.Package : FindMaskIndex(l3Caches, i);
+				topology.LogicalProcessors.push_back(processor);
+			}
+		}
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,241 @@
+#include <Arcane/Native/NativeFile.hpp>
+
+#include "WindowsCore.hpp"
+
+#include <Arcane/Math/Math.hpp>
+#include <vector>
+
+namespace Arcane {
+
+	void *_MapFile(const char *path, uint32_t hints, size_t *size) {
+		AR_ASSERT(path != nullptr, "Path cannot be null");
+		*size = 0;
+
+		DWORD flags = FILE_ATTRIBUTE_NORMAL;
+		if (hints & FileAccessHint_Sequential) flags |= FILE_FLAG_SEQUENTIAL_SCAN;
+		if (hints & FileAccessHint_Random) flags |= FILE_FLAG_RANDOM_ACCESS;
+
+		HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, flags, nullptr);
+		if (file == INVALID_HANDLE_VALUE) return nullptr;
+
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+			CloseHandle(file);
+			return nullptr;
+		}
+
+		HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		CloseHandle(file);
+		if (mapping == nullptr) {
+			AR_WINDOWS_ERROR("Failed to map {}: {}", path, GetWindowsErrorMessageString(GetLastError()));
+			return nullptr;
+		}
+
+		// The view keeps the mapping and the file open.
+		void *ptr = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+		CloseHandle(mapping);
+		if (ptr == nullptr) {
+			AR_WINDOWS_ERROR("Failed to map {}: {}", path, GetWindowsErrorMessageString(GetLastError()));
+			return nullptr;
+		}
+
+		if (hints & FileAccessHint_WillNeed) {
+			WIN32_MEMORY_RANGE_ENTRY range = { ptr, (SIZE_T)fileSize.QuadPart };
+			PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+		}
+
+		*size = (size_t)fileSize.QuadPart;
+		return ptr;
+	}
+
+	void _UnmapFile(void *ptr, size_t size) {
+		AR_ASSERT(ptr != nullptr, "Cannot unmap null pointer");
+
+		BOOL result = UnmapViewOfFile(ptr);
+		AR_WINDOWS_ASSERT(result, "Failed to unmap file: {}", GetWindowsErrorMessageString(GetLastError()));
+	}
+
+	FileHandle _OpenFile(const char *path, size_t *size) {
+		AR_ASSERT(path != nullptr, "Path cannot be null");
+		*size = 0;
+
+		HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (file == INVALID_HANDLE_VALUE) return AR_INVALID_FILE_HANDLE;
+
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(file, &fileSize)) {
+			CloseHandle(file);
+			return AR_INVALID_FILE_HANDLE;
+		}
+
+		*size = (size_t)fileSize.QuadPart;
+		return (FileHandle)file;
+	}
+
+	void _CloseFile(FileHandle file) {
+		AR_ASSERT(file != AR_INVALID_FILE_HANDLE, "Cannot close an invalid file");
+		CloseHandle((HANDLE)file);
+	}
+
+	int64_t _ReadFileAt(FileHandle file, void *buffer, size_t size, uint64_t offset) {
+		size_t total = 0;
+		while (total < size) {
+			// On a synchronous handle the offset in OVERLAPPED makes this a
+			// positioned read.
+			OVERLAPPED overlapped = {};
+			overlapped.Offset = (DWORD)(offset + total);
+			overlapped.OffsetHigh = (DWORD)((offset + total) >> 32);
+
+			const DWORD chunk = (DWORD)Min(size - total, (size_t)UINT32_MAX);
+			DWORD read = 0;
+			if (!ReadFile((HANDLE)file, (uint8_t*)buffer + total, chunk, &read, &overlapped)) {
+				if (GetLastError() == ERROR_HANDLE_EOF) break;
+				return -1;
+			}
+
+			if (read == 0) break;
+			total += read;
+		}
+
+		return (int64_t)total;
+	}
+
+	// Reads go through the fallback threads on Windows.
+	void *_CreateIORing(uint32_t depth) {
+		return nullptr;
+	}
+
+	void _DestroyIORing(void *ring) {
+		AR_ASSERT(false, "There is no IO ring on Windows");
+	}
+
+	bool _QueueRead(void *ring, FileHandle file, void *buffer, size_t size, uint64_t offset, void *userData) {
+		AR_ASSERT(false, "There is no IO ring on Windows");
+		return false;
+	}
+
+	bool _QueueWake(void *ring) {
+		AR_ASSERT(false, "There is no IO ring on Windows");
+		return false;
+	}
+
+	void _SubmitIORing(void *ring) {
+		AR_ASSERT(false, "There is no IO ring on Windows");
+	}
+
+	uint32_t _WaitIORing(void *ring, IOCompletion *completions, uint32_t max) {
+		AR_ASSERT(false, "There is no IO ring on Windows");
+		return 0;
+	}
+
+	struct WindowsDirectoryWatch {
+		HANDLE Directory;
+		OVERLAPPED Overlapped;
+		alignas(DWORD) uint8_t Buffer[16 * 1024];
+	};
+
+	struct WindowsDirectoryWatcher {
+		std::vector<WindowsDirectoryWatch*> Watches;
+		std::vector<HANDLE> Events;
+	};
+
+	static bool IssueDirectoryRead(WindowsDirectoryWatch *watch) {
+		return ReadDirectoryChangesW(
+			watch->Directory, watch->Buffer, sizeof(watch->Buffer), FALSE,
+			FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_FILE_NAME,
+			nullptr, &watch->Overlapped, nullptr
+		);
+	}
+
+	void *_CreateDirectoryWatcher() {
+		return new WindowsDirectoryWatcher();
+	}
+
+	void _DestroyDirectoryWatcher(void *watcher) {
+		WindowsDirectoryWatcher *w = (WindowsDirectoryWatcher*)watcher;
+
+		for (WindowsDirectoryWatch *watch : w->Watches) {
+			CancelIo(watch->Directory);
+			CloseHandle(watch->Directory);
+			CloseHandle(watch->Overlapped.hEvent);
+			delete watch;
+		}
+
+		delete w;
+	}
+
+	uint32_t _WatchDirectory(void *watcher, const char *path) {
+		AR_ASSERT(path != nullptr, "Path cannot be null");
+		WindowsDirectoryWatcher *w = (WindowsDirectoryWatcher*)watcher;
+
+		if (w->Watches.size() == MAXIMUM_WAIT_OBJECTS) {
+			AR_WINDOWS_ERROR("Cannot watch more than {} directories", MAXIMUM_WAIT_OBJECTS);
+			return UINT32_MAX;
+		}
+
+		HANDLE directory = CreateFileA(path, FILE_LIST_DIRECTORY, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr);
+		if (directory == INVALID_HANDLE_VALUE) {
+			AR_WINDOWS_ERROR("Failed to watch {}: {}", path, GetWindowsErrorMessageString(GetLastError()));
+			return UINT32_MAX;
+		}
+
+		WindowsDirectoryWatch *watch = new WindowsDirectoryWatch();
+		watch->Directory = directory;
+		watch->Overlapped = {};
+		watch->Overlapped.hEvent = CreateEventA(nullptr, FALSE, FALSE, nullptr);
+
+		if (!IssueDirectoryRead(watch)) {
+			AR_WINDOWS_ERROR("Failed to watch {}: {}", path, GetWindowsErrorMessageString(GetLastError()));
+			CloseHandle(watch->Overlapped.hEvent);
+			CloseHandle(directory);
+			delete watch;
+			return UINT32_MAX;
+		}
+
+		w->Watches.push_back(watch);
+		w->Events.push_back(watch->Overlapped.hEvent);
+		return (uint32_t)(w->Watches.size() - 1);
+	}
+
+	bool _ReadDirectoryChanges(void *watcher, uint32_t millis, DirectoryChangeFunc func, void *userData) {
+		WindowsDirectoryWatcher *w = (WindowsDirectoryWatcher*)watcher;
+		if (w->Events.empty()) {
+			Sleep(millis);
+			return false;
+		}
+
+		const DWORD result = WaitForMultipleObjects((DWORD)w->Events.size(), w->Events.data(), FALSE, millis == UINT32_MAX ? INFINITE : millis);
+		if (result < WAIT_OBJECT_0 || result >= WAIT_OBJECT_0 + w->Events.size()) return false;
+
+		const uint32_t index = result - WAIT_OBJECT_0;
+		WindowsDirectoryWatch *watch = w->Watches[index];
+
+		DWORD length = 0;
+		bool changed = false;
+		if (GetOverlappedResult(watch->Directory, &watch->Overlapped, &length, FALSE) && length > 0) {
+			char name[MAX_PATH * 3];
+
+			for (const uint8_t *entry = watch->Buffer;;) {
+				const FILE_NOTIFY_INFORMATION *info = (const FILE_NOTIFY_INFORMATION*)entry;
+
+				if (info->Action == FILE_ACTION_ADDED || info->Action == FILE_ACTION_MODIFIED || info->Action == FILE_ACTION_RENAMED_NEW_NAME) {
+					const int size = WideCharToMultiByte(CP_UTF8, 0, info->FileName, info->FileNameLength / sizeof(WCHAR), name, sizeof(name) - 1, nullptr, nullptr);
+					if (size > 0) {
+						name[size] = '\0';
+						func(index, name, userData);
+						changed = true;
+					}
+				}
+
+				if (info->NextEntryOffset == 0) break;
+				entry += info->NextEntryOffset;
+			}
+		} else if (length == 0) {
+			AR_WINDOWS_WARNING("Directory change buffer overflowed, file changes were lost");
+		}
+
+		IssueDirectoryRead(watch);
+		return changed;
+	}
+
+}
\ No newline at end of file
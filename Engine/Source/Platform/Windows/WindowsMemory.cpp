@@ -13,7 +13,7 @@ namespace Arcane {
 		void *ptr = HeapAlloc(processHeap, HEAP_ZERO_MEMORY, size);
 		AR_WINDOWS_ASSERT(ptr != nullptr, "Failed to allocate memory: {}", GetWindowsErrorMessageString(GetLastError()));
 
-		TracyAlloc(ptr, size);
+		AR_PROFILE_ALLOC(ptr, size);
 
 		return ptr;
 	}
@@ -27,8 +27,8 @@ namespace Arcane {
 		void *newPtr = HeapReAlloc(processHeap, HEAP_ZERO_MEMORY, ptr, size);
 		AR_WINDOWS_ASSERT(newPtr != nullptr, "Failed to reallocate memory: {}", GetWindowsErrorMessageString(GetLastError()));
 
-		TracyFree(ptr);
-		TracyAlloc(newPtr, size);
+		AR_PROFILE_FREE(ptr);
+		AR_PROFILE_ALLOC(newPtr, size);
 
 		return newPtr;
 	}
@@ -42,7 +42,7 @@ namespace Arcane {
 		BOOL result = HeapFree(processHeap, 0, ptr);
 		AR_WINDOWS_ASSERT(result, "Failed to free memory: {}", GetWindowsErrorMessageString(GetLastError()));
 
-		TracyFree(ptr);
+		AR_PROFILE_FREE(ptr);
 	}
 
 	void *_CopyMemory(void *dest, const void *src, size_t size) {
@@ -65,5 +65,54 @@ namespace Arcane {
 
 		return std::memset(ptr, value, size);
 	}
+
+	size_t _GetPageSize() {
+		static const size_t pageSize = []() {
+			SYSTEM_INFO info;
+			GetSystemInfo(&info);
+			return (size_t)info.dwPageSize;
+		}();
+		return pageSize;
+	}
+
+	void *_ReserveVirtual(size_t size, uint32_t flags) {
+		AR_ASSERT(size > 0, "Cannot reserve zero bytes");
+
+		// Large pages need SeLockMemoryPrivilege and must be committed when
+		// they are reserved, so VirtualMemoryFlag_HugePages is ignored here.
+		void *ptr = VirtualAlloc(nullptr, size, MEM_RESERVE, PAGE_NOACCESS);
+		AR_WINDOWS_ASSERT(ptr != nullptr, "Failed to reserve virtual memory: {}", GetWindowsErrorMessageString(GetLastError()));
+
+		return ptr;
+	}
+
+	void _ReleaseVirtual(void *ptr, size_t size) {
+		AR_ASSERT(ptr != nullptr, "Cannot release null pointer");
+
+		BOOL result = VirtualFree(ptr, 0, MEM_RELEASE);
+		AR_WINDOWS_ASSERT(result, "Failed to release virtual memory: {}", GetWindowsErrorMessageString(GetLastError()));
+	}
+
+	void _CommitVirtual(void *ptr, size_t size) {
+		AR_ASSERT(ptr != nullptr, "Cannot commit null pointer");
+		if (size == 0) return;
+
+		void *result = VirtualAlloc(ptr, size, MEM_COMMIT, PAGE_READWRITE);
+		AR_WINDOWS_ASSERT(result != nullptr, "Failed to commit virtual memory: {}", GetWindowsErrorMessageString(GetLastError()));
+	}
+
+	void _DecommitVirtual(void *ptr, size_t size) {
+		AR_ASSERT(ptr != nullptr, "Cannot decommit null pointer");
+
+		// VirtualFree() decommits every page the range touches, so shrink it
+		// to the pages that lie entirely inside.
+		const size_t pageSize = _GetPageSize();
+		const uintptr_t begin = ((uintptr_t)ptr + pageSize - 1) & ~(uintptr_t)(pageSize - 1);
+		const uintptr_t end = ((uintptr_t)ptr + size) & ~(uintptr_t)(pageSize - 1);
+		if (end <= begin) return;
+
+		BOOL result = VirtualFree((void*)begin, end - begin, MEM_DECOMMIT);
+		AR_WINDOWS_ASSERT(result, "Failed to decommit virtual memory: {}", GetWindowsErrorMessageString(GetLastError()));
+	}
 	
 }
\ No newline at end of file
@@ -33,22 +33,65 @@ namespace Arcane {
 	}
 
 	WindowsMutex::WindowsMutex() {
-		mMutex = CreateMutexA(NULL, FALSE, nullptr);
-		AR_ASSERT(mMutex != nullptr, "Failed to create mutex: {}", GetWindowsErrorMessageString(GetLastError()));
+		InitializeSRWLock(&mLock);
 	}
 
-	WindowsMutex::~WindowsMutex() {
-		CloseHandle(mMutex);
-	}
+	WindowsMutex::~WindowsMutex() { }
 
 	void WindowsMutex::Lock() {
-		DWORD result = WaitForSingleObject(mMutex, INFINITE);
-		AR_ASSERT(result == WAIT_OBJECT_0, "Failed to lock mutex: {}", GetWindowsErrorMessageString(GetLastError()));
+		AcquireSRWLockExclusive(&mLock);
 	}
 
 	void WindowsMutex::Unlock() {
-		BOOL result = ReleaseMutex(mMutex);
-		AR_ASSERT(result, "Failed to unlock mutex: {}", GetWindowsErrorMessageString(GetLastError()));
+		ReleaseSRWLockExclusive(&mLock);
+	}
+
+	WindowsConditionVariable::WindowsConditionVariable() {
+		InitializeConditionVariable(&mConditionVariable);
+	}
+
+	WindowsConditionVariable::~WindowsConditionVariable() { }
+
+	void WindowsConditionVariable::Wait(const Ref<NativeMutex> &mutex) {
+		Ref<WindowsMutex> windowsMutex = CastRef<WindowsMutex>(mutex);
+		BOOL result = SleepConditionVariableSRW(&mConditionVariable, &windowsMutex->mLock, INFINITE, 0);
+		AR_ASSERT(result, "Failed to wait on condition variable: {}", GetWindowsErrorMessageString(GetLastError()));
+	}
+
+	bool WindowsConditionVariable::Wait(const Ref<NativeMutex> &mutex, uint32_t millis) {
+		Ref<WindowsMutex> windowsMutex = CastRef<WindowsMutex>(mutex);
+		return SleepConditionVariableSRW(&mConditionVariable, &windowsMutex->mLock, millis, 0);
+	}
+
+	void WindowsConditionVariable::NotifyOne() {
+		WakeConditionVariable(&mConditionVariable);
+	}
+
+	void WindowsConditionVariable::NotifyAll() {
+		WakeAllConditionVariable(&mConditionVariable);
+	}
+
+	WindowsSemaphore::WindowsSemaphore(uint32_t count) {
+		mSemaphore = CreateSemaphoreA(nullptr, count, LONG_MAX, nullptr);
+		AR_ASSERT(mSemaphore != nullptr, "Failed to create semaphore: {}", GetWindowsErrorMessageString(GetLastError()));
+	}
+
+	WindowsSemaphore::~WindowsSemaphore() {
+		CloseHandle(mSemaphore);
+	}
+
+	void WindowsSemaphore::Wait() {
+		DWORD result = WaitForSingleObject(mSemaphore, INFINITE);
+		AR_ASSERT(result == WAIT_OBJECT_0, "Failed to wait on semaphore: {}", GetWindowsErrorMessageString(GetLastError()));
+	}
+
+	bool WindowsSemaphore::TryWait() {
+		return WaitForSingleObject(mSemaphore, 0) == WAIT_OBJECT_0;
+	}
+
+	void WindowsSemaphore::Post(uint32_t count) {
+		BOOL result = ReleaseSemaphore(mSemaphore, count, nullptr);
+		AR_ASSERT(result, "Failed to post semaphore: {}", GetWindowsErrorMessageString(GetLastError()));
 	}
 
 	WindowsThread::WindowsThread(ThreadFunc func, void *data) {
@@ -82,6 +125,19 @@ namespace Arcane {
 		TerminateThread(mThread, code);
 	}
 
+	void WindowsThread::SetAffinity(const CPUSet &cpus) {
+		// Only processor group 0 is addressed; larger machines would need
+		// SetThreadGroupAffinity.
+		DWORD_PTR mask = 0;
+		for (uint32_t i = 0; i < sizeof(DWORD_PTR) * 8; i++) {
+			if (cpus.test(i)) mask |= ((DWORD_PTR)1) << i;
+		}
+
+		if (mask == 0) return;
+		DWORD_PTR result = SetThreadAffinityMask(mThread, mask);
+		AR_ASSERT(result != 0, "Failed to set thread affinity: {}", GetWindowsErrorMessageString(GetLastError()));
+	}
+
 	int32_t WindowsThread::GetExitCode() const {
 		DWORD exitCode = 0;
 		GetExitCodeThread(mThread, &exitCode);
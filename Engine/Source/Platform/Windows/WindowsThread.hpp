@@ -7,6 +7,7 @@
 namespace Arcane {
 
 	class WindowsMutex : public NativeMutex {
+	friend class WindowsConditionVariable;
 	public:
 		WindowsMutex();
 		~WindowsMutex();
@@ -15,7 +16,34 @@ namespace Arcane {
 		virtual void Unlock() override;
 
 	private:
-		HANDLE mMutex;
+		SRWLOCK mLock;
+	};
+
+	class WindowsConditionVariable : public NativeConditionVariable {
+	public:
+		WindowsConditionVariable();
+		~WindowsConditionVariable();
+
+		virtual void Wait(const Ref<NativeMutex> &mutex) override;
+		virtual bool Wait(const Ref<NativeMutex> &mutex, uint32_t millis) override;
+		virtual void NotifyOne() override;
+		virtual void NotifyAll() override;
+
+	private:
+		CONDITION_VARIABLE mConditionVariable;
+	};
+
+	class WindowsSemaphore : public NativeSemaphore {
+	public:
+		WindowsSemaphore(uint32_t count);
+		~WindowsSemaphore();
+
+		virtual void Wait() override;
+		virtual bool TryWait() override;
+		virtual void Post(uint32_t count) override;
+
+	private:
+		HANDLE mSemaphore;
 	};
 
 	class WindowsThread : public NativeThread {
@@ -28,6 +56,7 @@ namespace Arcane {
 		virtual void Start() override;
 		virtual void Suspend() override;
 		virtual void Terminate(int32_t code) override;
+		virtual void SetAffinity(const CPUSet &cpus) override;
 		virtual int32_t GetExitCode() const override;
 		inline virtual ThreadID GetID() const override { return ((ThreadID)mID); }
 
@@ -19,4 +19,11 @@ namespace Arcane {
 		return (uint64_t)((double)counter.QuadPart / (double)sFrequency * 1000.0);
 	}
 
+	uint64_t _GetCurrentTimeMicros() {
+		LARGE_INTEGER counter;
+		QueryPerformanceCounter(&counter);
+
+		return (uint64_t)((double)counter.QuadPart / (double)sFrequency * 1000000.0);
+	}
+
 }
\ No newline at end of file
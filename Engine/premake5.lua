@@ -18,6 +18,11 @@ project "Engine"
 		os.getenv("VULKAN_SDK") .. "/Include"
 	}
 	
+	filter "system:linux"
+		removefiles {
+			"Source/Platform/Windows/**"
+		}
+
 	filter "configurations:Debug"
 		symbols "On"
 		defines {
@@ -1,5 +1,7 @@
 #include "Game.hpp"
 
+static const char *sModelPath = "Game/Assets/Models/dragon_floor.glb";
+
 Game::Game() {
 	mWindow = Window::Create(1920 / 2, 1080 / 2, "Arcane Engine");
 	mWindow.SetMaximized(true);
@@ -9,26 +11,80 @@ Game::Game() {
 
 	SetCurrentScene(&mScene);
 
-	SceneRenderer::Init();
+	mTextures[MaterialTexture_Albedo].Fill = Color::White();
+	mTextures[MaterialTexture_Normal].Fill = Color::Magenta();
+	mTextures[MaterialTexture_Metallic].Fill = Color::Gray();
+	mTextures[MaterialTexture_Roughness].Fill = Color::Black();
+	mTextures[MaterialTexture_AmbientOcclusion].Fill = Color::White();
 }
 
 Game::~Game() { }
 
-void Game::Start() {
-	Importer importer;
-	importer.Import("Game/Assets/Models/dragon_floor.glb", ImportFlag_SwapWindingOrder | ImportFlag_GenerateNormals | ImportFlag_GenerateTangents);
+void *Game::ImportModels(void *data) {
+	Game &game = *(Game*)data;
+	game.mImporter.Import(sModelPath, ImportFlag_SwapWindingOrder | ImportFlag_GenerateNormals | ImportFlag_GenerateTangents);
+	return nullptr;
+}
+
+void *Game::CreateMeshes(void *data) {
+	Game &game = *(Game*)data;
+	game.mBoxMesh = Mesh::Create(game.mContext, game.mImporter.GetNode(0).Mesh);
+	game.mFloorMesh = Mesh::Create(game.mContext, game.mImporter.GetNode(1).Mesh);
+	return nullptr;
+}
+
+void Game::OnModelChanged(const std::filesystem::path &path, void *userData) {
+	Game &game = *(Game*)userData;
+	game.mModelChanged.store(true, std::memory_order_relaxed);
+}
+
+// Meshes have to be created on the context, which belongs to the render
+// thread while the renderer is pipelined.
+void Game::ReloadModels() {
+	UncheckedAllocationScope unchecked;
+	Renderer::SetPipelined(false);
+
+	mImporter = Importer();
+	ImportModels(this);
+	CreateMeshes(this);
+
+	mFloor.Get<Mesh>() = mFloorMesh;
+	mBox.Get<Mesh>() = mBoxMesh;
+
+	Renderer::SetPipelined(true);
+}
+
+void *Game::DecodeTexture(void *data) {
+	TextureLoad &load = *(TextureLoad*)data;
+	load.Image = LoadImage(load.Fill, ImageFormat::RGB8);
+	return nullptr;
+}
+
+void *Game::UploadTexture(void *data) {
+	TextureLoad &load = *(TextureLoad*)data;
+	load.Texture = Texture::Create(load.Owner->mContext, load.Image);
+	load.Image = ImageData();
+	return nullptr;
+}
+
+void Game::Load(TaskGraph &startup) {
+	SceneRenderer::Init(startup);
 
-	ImageData colorTexture = LoadImage(Color::White(), ImageFormat::RGB8);
-	ImageData aoTexture = LoadImage(Color::White(), ImageFormat::RGB8);
-	ImageData roughnessMap = LoadImage(Color::Black(), ImageFormat::RGB8);
-	ImageData normalMap = LoadImage(Color::Magenta(), ImageFormat::RGB8);
-	ImageData grayImage = LoadImage(Color::Gray(), ImageFormat::RGB8);
+	const TaskGraphNodeID import = startup.AddTask("Import dragon_floor.glb", ImportModels, this);
+	startup.AddContextTask("Create meshes", CreateMeshes, this, { import });
+
+	for (TextureLoad &load : mTextures) {
+		load.Owner = this;
+		const TaskGraphNodeID decode = startup.AddTask("Decode texture", DecodeTexture, &load);
+		startup.AddContextTask("Upload texture", UploadTexture, &load, { decode });
+	}
+}
 
+void Game::Start() {
 	mFloor = Entity();
 	mFloor.Add<Tag>("Floor");
 
-	const Node &floorNode = importer.GetNode(1);
-	mFloor.Add<Mesh>(Mesh::Create(mContext, floorNode.Mesh));
+	mFloor.Add<Mesh>(mFloorMesh);
 
 	Mesh &m = mFloor.Get<Mesh>();
 	const Vector3 *positions = m.GetVertexBuffer(0).Map<Vector3>(MapMode::Read);
@@ -43,11 +99,11 @@ void Game::Start() {
 	m.GetVertexBuffer(0).Unmap();
 	
 	Material &floorMaterial = mFloor.Add<Material>();
-	floorMaterial.AlbedoMap = Texture::Create(mContext, colorTexture);
-	floorMaterial.NormalMap = Texture::Create(mContext, normalMap);
-	floorMaterial.MetallicMap = Texture::Create(mContext, grayImage);
-	floorMaterial.RoughnessMap = Texture::Create(mContext, roughnessMap);
-	floorMaterial.AmbientOcclusionMap = Texture::Create(mContext, aoTexture);
+	floorMaterial.AlbedoMap = mTextures[MaterialTexture_Albedo].Texture;
+	floorMaterial.NormalMap = mTextures[MaterialTexture_Normal].Texture;
+	floorMaterial.MetallicMap = mTextures[MaterialTexture_Metallic].Texture;
+	floorMaterial.RoughnessMap = mTextures[MaterialTexture_Roughness].Texture;
+	floorMaterial.AmbientOcclusionMap = mTextures[MaterialTexture_AmbientOcclusion].Texture;
 
 	Transform &floorTransform = mFloor.Add<Transform>();
 	floorTransform.Position = { 0.0f, -1.0f, 0.0f };
@@ -55,14 +111,14 @@ void Game::Start() {
 	mBox = Entity();
 	mBox.Add<Tag>("Box");
 	
-	mBox.Add<Mesh>(Mesh::Create(mContext, importer.GetNode(0).Mesh));
+	mBox.Add<Mesh>(mBoxMesh);
 	
 	Material &boxMaterial = mBox.Add<Material>();
-	boxMaterial.AlbedoMap = Texture::Create(mContext, colorTexture);
-	boxMaterial.NormalMap = Texture::Create(mContext, normalMap);
-	boxMaterial.MetallicMap = Texture::Create(mContext, grayImage);
-	boxMaterial.RoughnessMap = Texture::Create(mContext, roughnessMap);
-	boxMaterial.AmbientOcclusionMap = Texture::Create(mContext, aoTexture);
+	boxMaterial.AlbedoMap = mTextures[MaterialTexture_Albedo].Texture;
+	boxMaterial.NormalMap = mTextures[MaterialTexture_Normal].Texture;
+	boxMaterial.MetallicMap = mTextures[MaterialTexture_Metallic].Texture;
+	boxMaterial.RoughnessMap = mTextures[MaterialTexture_Roughness].Texture;
+	boxMaterial.AmbientOcclusionMap = mTextures[MaterialTexture_AmbientOcclusion].Texture;
 	
 	Transform &boxTransform = mBox.Add<Transform>();
 	boxTransform.Position = { 0.0f, 3.0f, 0.0f };
@@ -82,10 +138,22 @@ void Game::Start() {
 	mSun = Entity();
 	mSun.Add<Tag>("Sun");
 	mSun.Add<DirectionalLight>(Color::Gray());
-	mSun.Add<Transform>(Vector3::Zero(), Vector3(-45.0f, 0.0f, 0.0f));
+	// Points down at 45 degrees along +X.
+	mSun.Add<Transform>(Vector3::Zero(), Vector3(0.0f, 0.0f, 45.0f));
+
+	mModelWatch = GetFileWatcher().Watch(sModelPath, OnModelChanged, this);
+
+	Renderer::SetPipelined(true);
+	SetSteadyStateAllocationCheck(true);
 }
 
 void Game::Update() {
+	// Models are usually saved from another program, while the game does
+	// not have focus.
+	if (mModelChanged.exchange(false, std::memory_order_relaxed)) {
+		ReloadModels();
+	}
+
 	if (mWindow.IsFocused()) {
 		SetCursorLocked(true);
 		SetCursorVisible(false);
@@ -97,7 +165,7 @@ void Game::Update() {
 		if (pitch <= -89.9f) pitch = -89.9f;
 
 		Camera3D &cam = mPlayer.Get<RenderCamera>().GetCamera();
-		// mPlayer.Get<Transform>().Rotation = Vector3(yaw, pitch, 0.0f);
+		// mPlayer.Get<Transform>().SetEulerAngles(Vector3(yaw, pitch, 0.0f));
 
 		Vector3 direction = Vector3(0);
 		direction.X = Cos(ToRadians(yaw)) * Cos(ToRadians(pitch));
@@ -105,10 +173,6 @@ void Game::Update() {
 		direction.Z = Sin(ToRadians(yaw)) * Cos(ToRadians(pitch));
 		// cam.Front = mPlayer.Get<Transform>().GetDirection();
 
-		if (IsKeyDown(KeyCode::R)) {
-			Renderer::Reload();
-		}
-
 		if (IsKeyPressed(KeyCode::Space))
 			cam.Position += cam.Up * speed * GetDeltaTime();
 		if (IsKeyPressed(KeyCode::LeftShift) || IsKeyPressed(KeyCode::RightShift))
@@ -132,12 +196,13 @@ void Game::Update() {
 
 void Game::Render() {
 	SceneRenderer::Draw();
-	const FrameStatistics &frameStats = Renderer::GetRenderer().GetFrameStatistics();
-	mContext.Present();
+	const FrameStatistics &frameStats = Renderer::GetFrameStatistics();
+	Renderer::Present();
 	mWindow.Update();
 }
 
 void Game::Stop() {
+	GetFileWatcher().Unwatch(mModelWatch);
 	SceneRenderer::Shutdown();
 }
 
@@ -11,6 +11,7 @@ public:
 	Game();
 	~Game();
 
+	virtual void Load(TaskGraph &startup) override;
 	virtual void Start() override;
 	virtual void Update() override;
 	virtual void Render() override;
@@ -18,11 +19,41 @@ public:
 
 	virtual bool IsRunning() const override { return !mWindow.IsClosed(); }
 
+private:
+	enum MaterialTexture {
+		MaterialTexture_Albedo = 0,
+		MaterialTexture_Normal,
+		MaterialTexture_Metallic,
+		MaterialTexture_Roughness,
+		MaterialTexture_AmbientOcclusion,
+		MaterialTexture_Count
+	};
+
+	struct TextureLoad {
+		Game *Owner;
+		Color Fill;
+		ImageData Image;
+		Texture Texture;
+	};
+
+	static void *ImportModels(void *data);
+	static void *CreateMeshes(void *data);
+	static void *DecodeTexture(void *data);
+	static void *UploadTexture(void *data);
+	// Shaders are reloaded by the renderer itself.
+	static void OnModelChanged(const std::filesystem::path &path, void *userData);
+	void ReloadModels();
+
 private:
 	Window mWindow;
 	GraphicsContext mContext;
 	Scene mScene;
-	ThreadPool mThreads;
+
+	Importer mImporter;
+	Mesh mFloorMesh, mBoxMesh;
+	FileWatchID mModelWatch;
+	std::atomic<bool> mModelChanged = false;
+	TextureLoad mTextures[MaterialTexture_Count];
 
 	Entity mFloor, mBox, mSun, mPlayer;
 };
\ No newline at end of file
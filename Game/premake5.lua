@@ -21,17 +21,26 @@ project "Game"
 	}
 
 	links {
-		"gdi32",
-		"opengl32",
 		"Engine",
 		"tracy",
-		"ws2_32",
-		"winmm",
-		"dbghelp",
-		"shlwapi",
-		"vulkan-1",
 	}
 
+	filter "system:windows"
+		links {
+			"gdi32",
+			"opengl32",
+			"ws2_32",
+			"winmm",
+			"dbghelp",
+			"shlwapi",
+			"vulkan-1",
+		}
+
+	filter "system:linux"
+		links {
+			"pthread"
+		}
+
 	filter "configurations:Debug"
 		symbols "On"
 		defines {
@@ -4,4 +4,5 @@ workspace "Arcane"
 
 	include "Engine/Libraries/tracy"
 	include "Engine"
-	include "Game"
\ No newline at end of file
+	include "Game"
+	include "Benchmarks"
\ No newline at end of file